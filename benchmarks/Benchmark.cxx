@@ -0,0 +1,78 @@
+/*!
+ * \file   benchmarks/Benchmark.cxx
+ * \brief  This file implements the benchmarking harness
+ * \author Thomas Helfer
+ * \date   08/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include "Benchmark.hxx"
+
+static std::atomic<std::size_t> number_of_allocations{0};
+
+// The global allocation functions are replaced to count the allocations
+// performed by the benchmarks. The other forms of `operator new` fall back
+// to this one.
+void* operator new(std::size_t s) {
+  number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* const p = std::malloc(s == 0 ? 1 : s)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}  // end of operator new
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace tfel::math::enzyme::benchmarks {
+
+  std::size_t getNumberOfAllocations() noexcept {
+    return number_of_allocations.load(std::memory_order_relaxed);
+  }  // end of getNumberOfAllocations
+
+  BenchmarkSuite::BenchmarkSuite(std::string n, const std::size_t ncalls)
+      : name(std::move(n)), number_of_calls(ncalls) {}  // end of BenchmarkSuite
+
+  void BenchmarkSuite::report(std::ostream& os) const {
+    os << "# " << this->name << " (" << this->number_of_calls
+       << " calls per benchmark)\n";
+    os << std::left << std::setw(48) << "benchmark" << std::right
+       << std::setw(12) << "ns/call" << std::setw(12) << "overhead"
+       << std::setw(12) << "allocs" << std::setw(14) << "error" << '\n';
+    auto print = [this, &os](const BenchmarkResult& r) {
+      os << std::left << std::setw(48) << r.name << std::right << std::fixed
+         << std::setprecision(2) << std::setw(12) << r.time;
+      if (this->primal.has_value()) {
+        os << std::setw(12) << r.time / this->primal->time;
+      } else {
+        os << std::setw(12) << "-";
+      }
+      os << std::setw(12) << r.allocations;
+      if (r.error.has_value()) {
+        os << std::scientific << std::setprecision(3) << std::setw(14)
+           << *(r.error);
+      } else {
+        os << std::setw(14) << "-";
+      }
+      os << std::defaultfloat << '\n';
+    };
+    if (this->primal.has_value()) {
+      print(*(this->primal));
+    }
+    for (const auto& r : this->results) {
+      print(r);
+    }
+    os << '\n';
+  }  // end of report
+
+}  // end of namespace tfel::math::enzyme::benchmarks
@@ -0,0 +1,147 @@
+/*!
+ * \file   benchmarks/Benchmark.hxx
+ * \brief  This file declares a minimal benchmarking harness
+ * \author Thomas Helfer
+ * \date   08/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_BENCHMARKS_BENCHMARK_HXX
+#define LIB_TFEL_MATH_ENZYME_BENCHMARKS_BENCHMARK_HXX
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <ostream>
+#include <utility>
+#include <optional>
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+
+namespace tfel::math::enzyme::benchmarks {
+
+  //! \return the number of calls to the global `operator new` so far
+  std::size_t getNumberOfAllocations() noexcept;
+
+  /*!
+   * \brief prevent the compiler from discarding the given value. The address
+   * of the value escapes, so that the compiler can't assume that it is not
+   * modified by `clobberMemory`.
+   */
+  template <typename ValueType>
+  inline void doNotOptimize(const ValueType& v) {
+    asm volatile("" : : "g"(&v) : "memory");
+  }
+
+  //! \brief prevent the compiler from caching values across this point
+  inline void clobberMemory() { asm volatile("" : : : "memory"); }
+
+  //! \return the name of a differentiation mode
+  constexpr const char* getModeName(const Mode m) noexcept {
+    if (m == Mode::FORWARD) {
+      return "FORWARD";
+    } else if (m == Mode::REVERSE) {
+      return "REVERSE";
+    }
+    return "AUTO";
+  }  // end of getModeName
+
+  //! \brief result of a benchmark
+  struct BenchmarkResult {
+    //! \brief name of the benchmark
+    std::string name;
+    //! \brief mean time per call, in nanoseconds
+    double time;
+    //! \brief mean number of allocations per call
+    double allocations;
+    //! \brief error with respect to the reference derivative, if any
+    std::optional<double> error;
+  };
+
+  /*!
+   * \brief a set of benchmarks sharing a reference primal evaluation.
+   *
+   * The time per call of each benchmark is reported as well as its ratio to
+   * the time per call of the primal evaluation.
+   */
+  struct BenchmarkSuite {
+    /*!
+     * \param[in] n: name of the suite
+     * \param[in] ncalls: number of calls per measurement
+     */
+    BenchmarkSuite(std::string, const std::size_t = 100000);
+    /*!
+     * \brief time the primal evaluation
+     * \param[in] n: name of the benchmark
+     * \param[in] f: callable to be timed
+     */
+    template <typename CallableType>
+    void setPrimal(std::string, const CallableType&);
+    /*!
+     * \brief time a callable
+     * \param[in] n: name of the benchmark
+     * \param[in] f: callable to be timed
+     */
+    template <typename CallableType>
+    void add(std::string, const CallableType&);
+    /*!
+     * \brief time a callable and record the error of its result with respect
+     * to a reference value.
+     * \param[in] n: name of the benchmark
+     * \param[in] f: callable to be timed
+     * \param[in] e: callable returning the error of a result
+     */
+    template <typename CallableType, typename ErrorFunctionType>
+    void add(std::string, const CallableType&, const ErrorFunctionType&);
+    //! \brief print the results
+    void report(std::ostream&) const;
+
+   private:
+    //! \return the mean time per call and number of allocations per call
+    template <typename CallableType>
+    std::pair<double, double> measure(const CallableType&) const;
+    //! \brief name of the suite
+    const std::string name;
+    //! \brief number of calls per measurement
+    const std::size_t number_of_calls;
+    //! \brief time per call of the primal evaluation
+    std::optional<BenchmarkResult> primal;
+    //! \brief results
+    std::vector<BenchmarkResult> results;
+  };  // end of BenchmarkSuite
+
+  /*!
+   * \brief compute the derivative of a scalar callable by central finite
+   * differences
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] h: perturbation
+   */
+  template <typename CallableType, typename VariableType>
+  auto computeCentralFiniteDifference(const CallableType&,
+                                      const VariableType&,
+                                      const VariableType&);
+
+  /*!
+   * \brief compute the derivative of a callable with respect to a math
+   * object by central finite differences
+   * \tparam DerivativeType: type of the derivative
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] h: perturbation
+   */
+  template <typename DerivativeType, typename CallableType, typename VariableType>
+  DerivativeType computeCentralFiniteDifferences(
+      const CallableType&,
+      const VariableType&,
+      const typename VariableType::value_type&);
+
+}  // end of namespace tfel::math::enzyme::benchmarks
+
+#include "Benchmark.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_BENCHMARKS_BENCHMARK_HXX */
@@ -0,0 +1,104 @@
+/*!
+ * \file   benchmarks/Benchmark.ixx
+ * \brief  This file implements the template methods of the benchmarking
+ * harness
+ * \author Thomas Helfer
+ * \date   08/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_BENCHMARKS_BENCHMARK_IXX
+#define LIB_TFEL_MATH_ENZYME_BENCHMARKS_BENCHMARK_IXX
+
+#include <chrono>
+#include <type_traits>
+
+namespace tfel::math::enzyme::benchmarks {
+
+  template <typename CallableType>
+  std::pair<double, double> BenchmarkSuite::measure(
+      const CallableType& f) const {
+    using clock = std::chrono::steady_clock;
+    // warm-up
+    for (std::size_t i = 0; i != this->number_of_calls / 10 + 1; ++i) {
+      doNotOptimize(f());
+    }
+    const auto a0 = getNumberOfAllocations();
+    const auto t0 = clock::now();
+    for (std::size_t i = 0; i != this->number_of_calls; ++i) {
+      doNotOptimize(f());
+      clobberMemory();
+    }
+    const auto t1 = clock::now();
+    const auto a1 = getNumberOfAllocations();
+    const auto n = static_cast<double>(this->number_of_calls);
+    const auto dt = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    return {dt / n, static_cast<double>(a1 - a0) / n};
+  }  // end of measure
+
+  template <typename CallableType>
+  void BenchmarkSuite::setPrimal(std::string n, const CallableType& f) {
+    const auto [t, a] = this->measure(f);
+    this->primal = BenchmarkResult{
+        .name = std::move(n), .time = t, .allocations = a, .error = {}};
+  }  // end of setPrimal
+
+  template <typename CallableType>
+  void BenchmarkSuite::add(std::string n, const CallableType& f) {
+    const auto [t, a] = this->measure(f);
+    this->results.push_back(BenchmarkResult{
+        .name = std::move(n), .time = t, .allocations = a, .error = {}});
+  }  // end of add
+
+  template <typename CallableType, typename ErrorFunctionType>
+  void BenchmarkSuite::add(std::string n,
+                           const CallableType& f,
+                           const ErrorFunctionType& e) {
+    const auto [t, a] = this->measure(f);
+    this->results.push_back(
+        BenchmarkResult{.name = std::move(n),
+                        .time = t,
+                        .allocations = a,
+                        .error = static_cast<double>(e(f()))});
+  }  // end of add
+
+  template <typename CallableType, typename VariableType>
+  auto computeCentralFiniteDifference(const CallableType& c,
+                                      const VariableType& x,
+                                      const VariableType& h) {
+    return (c(x + h) - c(x - h)) / (2 * h);
+  }  // end of computeCentralFiniteDifference
+
+  template <typename DerivativeType, typename CallableType, typename VariableType>
+  DerivativeType computeCentralFiniteDifferences(
+      const CallableType& c,
+      const VariableType& x,
+      const typename VariableType::value_type& h) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    using size_type = typename VariableType::size_type;
+    auto r = DerivativeType{};
+    for (size_type j = 0; j != x.size(); ++j) {
+      auto xp = x;
+      auto xm = x;
+      xp[j] += h;
+      xm[j] -= h;
+      if constexpr (std::is_arithmetic_v<ResultType>) {
+        r[j] = (c(xp) - c(xm)) / (2 * h);
+      } else {
+        const ResultType d = (c(xp) - c(xm)) / (2 * h);
+        for (size_type i = 0; i != d.size(); ++i) {
+          r(i, j) = d[i];
+        }
+      }
+    }
+    return r;
+  }  // end of computeCentralFiniteDifferences
+
+}  // end of namespace tfel::math::enzyme::benchmarks
+
+#endif /* LIB_TFEL_MATH_ENZYME_BENCHMARKS_BENCHMARK_IXX */
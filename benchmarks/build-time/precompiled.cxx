@@ -0,0 +1,28 @@
+/*!
+ * \file   benchmarks/build-time/precompiled.cxx
+ * \brief  Translation unit computing the derivatives of the von Mises
+ * equivalent stress with the precompiled kernels. Only its build time is
+ * measured.
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ */
+
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/Enzyme/Kernels.hxx"
+
+using namespace tfel::math;
+using namespace tfel::math::enzyme;
+
+template <unsigned short N>
+static double computeDerivatives(const stensor<N, double>& s) {
+  return abs(kernels::computeVonMisesNormal(s)) +
+         abs(kernels::computeVonMisesNormalDerivative(s));
+}  // end of computeDerivatives
+
+double computeDerivatives(const stensor<1u, double>& s1,
+                          const stensor<2u, double>& s2,
+                          const stensor<3u, double>& s3) {
+  return computeDerivatives(s1) + computeDerivatives(s2) +
+         computeDerivatives(s3);
+}  // end of computeDerivatives
@@ -0,0 +1,122 @@
+/*!
+ * \file   benchmarks/scalar.cxx
+ * \brief  Benchmarks of the derivatives of scalar functions
+ * \author Thomas Helfer
+ * \date   08/08/2025
+ */
+
+#include <cmath>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeDerivative.hxx"
+#include "TFEL/Math/Enzyme/getDerivativeFunction.hxx"
+#include "Benchmark.hxx"
+
+using namespace tfel::math;
+using namespace tfel::math::enzyme;
+using namespace tfel::math::enzyme::benchmarks;
+
+static void benchmarkDouble() {
+  const auto f = [](const double x) { return std::sin(x) * std::exp(x); };
+  const auto df = [](const double x) {
+    return std::exp(x) * (std::sin(x) + std::cos(x));
+  };
+  const auto d2f = [](const double x) { return 2 * std::exp(x) * std::cos(x); };
+  auto x = double{0.3};
+  doNotOptimize(x);
+  const auto e1 = [&x, &df](const double v) { return std::abs(v - df(x)); };
+  const auto e2 = [&x, &d2f](const double v) { return std::abs(v - d2f(x)); };
+  // first order
+  auto s1 = BenchmarkSuite("double, first order derivative");
+  s1.setPrimal("primal", [&x, &f] { return f(x); });
+  s1.add("analytic", [&x, &df] { return df(x); }, e1);
+  s1.add(
+      "central finite difference",
+      [&x, &f] { return computeCentralFiniteDifference(f, x, 1e-6); }, e1);
+  s1.add(
+      "fwddiff", [&x, &f] { return fwddiff(f, make_vdv<double>(x, 1)); }, e1);
+  s1.add(
+      "computeForwardModeDerivative",
+      [&x, &f] { return computeForwardModeDerivative(f, x); }, e1);
+  s1.add(
+      "computeReverseModeDerivative",
+      [&x, &f] { return computeReverseModeDerivative(f, x); }, e1);
+  s1.add(
+      "computeDerivative<FORWARD>",
+      [&x, &f] { return computeDerivative<Mode::FORWARD, 0>(f, x); }, e1);
+  s1.add(
+      "computeDerivative<REVERSE>",
+      [&x, &f] { return computeDerivative<Mode::REVERSE, 0>(f, x); }, e1);
+  s1.add(
+      std::string("computeDerivative<AUTO> (") +
+          getModeName(getAutomaticMode<0>(f)) + ")",
+      [&x, &f] { return computeDerivative<Mode::AUTO, 0>(f, x); }, e1);
+  const auto df_fwd = getDerivativeFunction<Mode::FORWARD, 0>(f);
+  const auto df_rev = getDerivativeFunction<Mode::REVERSE, 0>(f);
+  s1.add(
+      "getDerivativeFunction<FORWARD, 0>", [&x, &df_fwd] { return df_fwd(x); },
+      e1);
+  s1.add(
+      "getDerivativeFunction<REVERSE, 0>", [&x, &df_rev] { return df_rev(x); },
+      e1);
+  s1.report(std::cout);
+  // second order
+  auto s2 = BenchmarkSuite("double, second order derivative");
+  s2.setPrimal("primal", [&x, &f] { return f(x); });
+  s2.add("analytic", [&x, &d2f] { return d2f(x); }, e2);
+  s2.add(
+      "central finite difference",
+      [&x, &df] { return computeCentralFiniteDifference(df, x, 1e-6); }, e2);
+  const auto d2f_fwd = getDerivativeFunction<Mode::FORWARD, 0, 0>(f);
+  const auto d2f_rev = getDerivativeFunction<Mode::REVERSE, 0, 0>(f);
+  s2.add(
+      "getDerivativeFunction<FORWARD, 0, 0>",
+      [&x, &d2f_fwd] { return d2f_fwd(x); }, e2);
+  s2.add(
+      "getDerivativeFunction<REVERSE, 0, 0>",
+      [&x, &d2f_rev] { return d2f_rev(x); }, e2);
+  s2.report(std::cout);
+}  // end of benchmarkDouble
+
+static void benchmarkQuantity() {
+  using strain = qt<NoUnit, double>;
+  constexpr auto E = qt<Stress, double>{150e9};
+  const auto w = [](const strain e) { return E * e * e / 2; };
+  const auto sig = [](const strain e) { return E * e; };
+  auto e = strain{1e-3};
+  doNotOptimize(e);
+  const auto error = [&e, &sig](const qt<Stress, double> v) {
+    return std::abs((v - sig(e)).getValue());
+  };
+  auto s = BenchmarkSuite("quantity, first order derivative");
+  s.setPrimal("primal", [&e, &w] { return w(e); });
+  s.add("analytic", [&e, &sig] { return sig(e); }, error);
+  s.add(
+      "central finite difference",
+      [&e, &w] { return computeCentralFiniteDifference(w, e, strain{1e-8}); },
+      error);
+  s.add(
+      "computeForwardModeDerivative",
+      [&e, &w] { return computeForwardModeDerivative(w, e); }, error);
+  s.add(
+      "computeReverseModeDerivative",
+      [&e, &w] { return computeReverseModeDerivative(w, e); }, error);
+  s.add(
+      "computeDerivative<FORWARD>",
+      [&e, &w] { return computeDerivative<Mode::FORWARD, 0>(w, e); }, error);
+  s.add(
+      "computeDerivative<REVERSE>",
+      [&e, &w] { return computeDerivative<Mode::REVERSE, 0>(w, e); }, error);
+  s.report(std::cout);
+}  // end of benchmarkQuantity
+
+int main() {
+  benchmarkDouble();
+  benchmarkQuantity();
+  return EXIT_SUCCESS;
+}
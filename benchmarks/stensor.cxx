@@ -0,0 +1,179 @@
+/*!
+ * \file   benchmarks/stensor.cxx
+ * \brief  Benchmarks of the derivatives of functions of symmetric tensors
+ * \author Thomas Helfer
+ * \date   08/08/2025
+ */
+
+#include <cmath>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeDerivative.hxx"
+#include "TFEL/Math/Enzyme/getDerivativeFunction.hxx"
+#include "TFEL/Math/Enzyme/computeHessianVectorProduct.hxx"
+#include "Benchmark.hxx"
+
+using namespace tfel::math;
+using namespace tfel::material;
+using namespace tfel::math::enzyme;
+using namespace tfel::math::enzyme::benchmarks;
+
+//! \return the maximum absolute difference between two math objects
+template <typename MathObjectType>
+static double computeError(const MathObjectType& a, const MathObjectType& b) {
+  auto e = double{};
+  auto pb = b.begin();
+  for (const auto& v : a) {
+    e = std::max(e, std::abs(v - *pb));
+    ++pb;
+  }
+  return e;
+}  // end of computeError
+
+template <unsigned short N>
+static void benchmarkHooke() {
+  using Stensor = stensor<N, double>;
+  using Stensor4 = st2tost2<N, double>;
+  constexpr auto E = double{70e9};
+  constexpr auto nu = double{0.3};
+  constexpr auto lambda = computeLambda(E, nu);
+  constexpr auto mu = computeMu(E, nu);
+  const auto hooke_potential = [](const Stensor& e) {
+    return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+  };
+  const auto hooke_law = [](const Stensor& e) -> Stensor {
+    return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+  };
+  const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+  auto e = Stensor(0);
+  e[0] = 1e-3;
+  e[1] = -2e-4;
+  doNotOptimize(e);
+  const auto de = Stensor(1e-3);
+  const auto suffix = ", N = " + std::to_string(N);
+  const auto e1 = [&e, &hooke_law](const Stensor& v) {
+    return computeError(v, hooke_law(e));
+  };
+  const auto e2 = [&K_ref](const Stensor4& v) {
+    return computeError(v, K_ref);
+  };
+  // first order: stress
+  auto s1 = BenchmarkSuite("stensor, first order derivative" + suffix);
+  s1.setPrimal("primal", [&e, &hooke_potential] { return hooke_potential(e); });
+  s1.add("analytic", [&e, &hooke_law] { return hooke_law(e); }, e1);
+  s1.add(
+      "central finite differences",
+      [&e, &hooke_potential] {
+        return computeCentralFiniteDifferences<Stensor>(hooke_potential, e,
+                                                        1e-8);
+      },
+      e1);
+  s1.add(
+      "fwddiff (directional derivative)",
+      [&e, &de, &hooke_potential] {
+        return fwddiff(hooke_potential, make_vdv<Stensor>(e, de));
+      },
+      [&e, &de, &hooke_law](const double v) {
+        return std::abs(v - (hooke_law(e) | de));
+      });
+  s1.add(
+      "computeForwardModeDerivative",
+      [&e, &hooke_potential] {
+        return computeForwardModeDerivative(hooke_potential, e);
+      },
+      e1);
+  s1.add(
+      "computeReverseModeDerivative",
+      [&e, &hooke_potential] {
+        return computeReverseModeDerivative(hooke_potential, e);
+      },
+      e1);
+  s1.add(
+      "computeDerivative<FORWARD>",
+      [&e, &hooke_potential] {
+        return computeDerivative<Mode::FORWARD, 0>(hooke_potential, e);
+      },
+      e1);
+  s1.add(
+      "computeDerivative<REVERSE>",
+      [&e, &hooke_potential] {
+        return computeDerivative<Mode::REVERSE, 0>(hooke_potential, e);
+      },
+      e1);
+  s1.add(
+      std::string("computeDerivative<AUTO> (") +
+          getModeName(getAutomaticMode<0>(hooke_potential)) + ")",
+      [&e, &hooke_potential] {
+        return computeDerivative<Mode::AUTO, 0>(hooke_potential, e);
+      },
+      e1);
+  const auto stress_fwd = getDerivativeFunction<Mode::FORWARD, 0>(hooke_potential);
+  const auto stress_rev = getDerivativeFunction<Mode::REVERSE, 0>(hooke_potential);
+  s1.add(
+      "getDerivativeFunction<FORWARD, 0>",
+      [&e, &stress_fwd] { return stress_fwd(e); }, e1);
+  s1.add(
+      "getDerivativeFunction<REVERSE, 0>",
+      [&e, &stress_rev] { return stress_rev(e); }, e1);
+  s1.report(std::cout);
+  // second order: stiffness
+  auto s2 = BenchmarkSuite("stensor, second order derivative" + suffix);
+  s2.setPrimal("primal", [&e, &hooke_potential] { return hooke_potential(e); });
+  s2.add("analytic", [&K_ref] { return K_ref; }, e2);
+  s2.add(
+      "central finite differences",
+      [&e, &hooke_law] {
+        return computeCentralFiniteDifferences<Stensor4>(hooke_law, e, 1e-8);
+      },
+      e2);
+  s2.add(
+      "computeForwardModeDerivative (hooke law)",
+      [&e, &hooke_law] { return computeForwardModeDerivative(hooke_law, e); },
+      e2);
+  s2.add(
+      "computeReverseModeDerivative (hooke law)",
+      [&e, &hooke_law] { return computeReverseModeDerivative(hooke_law, e); },
+      e2);
+  s2.add(
+      std::string("computeDerivative<AUTO> (hooke law, ") +
+          getModeName(getAutomaticMode<0>(hooke_law)) + ")",
+      [&e, &hooke_law] {
+        return computeDerivative<Mode::AUTO, 0>(hooke_law, e);
+      },
+      e2);
+  const auto K_fwd = getDerivativeFunction<Mode::FORWARD, 0, 0>(hooke_potential);
+  const auto K_rev = getDerivativeFunction<Mode::REVERSE, 0, 0>(hooke_potential);
+  s2.add(
+      "getDerivativeFunction<FORWARD, 0, 0>", [&e, &K_fwd] { return K_fwd(e); },
+      e2);
+  s2.add(
+      "getDerivativeFunction<REVERSE, 0, 0>", [&e, &K_rev] { return K_rev(e); },
+      e2);
+  // hessian-vector product, compared to the product of the stiffness
+  s2.add(
+      "computeHessianVectorProduct",
+      [&e, &de, &hooke_potential] {
+        return computeHessianVectorProduct(hooke_potential, e, de);
+      },
+      [&de, &K_ref](const Stensor& v) {
+        const Stensor Kde = K_ref * de;
+        return computeError(v, Kde);
+      });
+  s2.report(std::cout);
+}  // end of benchmarkHooke
+
+int main() {
+  benchmarkHooke<1>();
+  benchmarkHooke<2>();
+  benchmarkHooke<3>();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+# This module provides functions building libraries and executables using
+# the staged optimisation pipeline of `test-suite/test1/Makefile`:
+#
+# 1. the sources are compiled to `LLVM` IR with the optimisations that
+#    prevent Enzyme from generating efficient derivatives disabled
+#    (vectorisation and loop unrolling),
+# 2. the `enzyme` pass is run by `opt` on the IR,
+# 3. the differentiated IR is optimised by `opt -O3`,
+# 4. the object files are generated by `llc`.
+#
+# In `LTO` mode, the IR of all the sources is linked in one module by
+# `llvm-link` before running the `enzyme` pass, so that functions defined
+# in other translation units can be differentiated.
+#
+# The `opt`, `llc` and `llvm-link` tools are searched in the `bin`
+# directory of the `LLVM` installation used by Enzyme. The configuration
+# stops if a tool required by a target is missing.
+#
+# Usage:
+#
+# ~~~~{.cmake}
+# tfel_math_enzyme_add_optimized_library(<target> [STATIC|SHARED] [LTO]
+#                                        SOURCES <sources>...
+#                                        [LINK_LIBRARIES <libraries>...])
+# tfel_math_enzyme_add_optimized_executable(<target> [LTO]
+#                                           SOURCES <sources>...
+#                                           [LINK_LIBRARIES <libraries>...])
+# ~~~~
+#
+# The include directories and the compile definitions of the libraries
+# given in `LINK_LIBRARIES` are used to compile the sources. Their compile
+# options are not, since they would load the Enzyme plugin in `clang`.
+
+set(TFEL_MATH_ENZYME_PRE_ENZYME_FLAGS
+    "-O2;-fno-vectorize;-fno-slp-vectorize;-fno-unroll-loops"
+    CACHE STRING "flags used to compile the sources to LLVM IR")
+set(TFEL_MATH_ENZYME_POST_ENZYME_FLAGS "-O3"
+    CACHE STRING "flags passed to opt after the enzyme pass")
+
+find_program(TFEL_MATH_ENZYME_OPT opt
+             HINTS "${Enzyme_LLVM_BINARY_DIR}/bin" NO_DEFAULT_PATH)
+find_program(TFEL_MATH_ENZYME_LLC llc
+             HINTS "${Enzyme_LLVM_BINARY_DIR}/bin" NO_DEFAULT_PATH)
+find_program(TFEL_MATH_ENZYME_LLVM_LINK llvm-link
+             HINTS "${Enzyme_LLVM_BINARY_DIR}/bin" NO_DEFAULT_PATH)
+
+# stop at configure time if one of the given tools has not been found
+function(tfel_math_enzyme_check_pipeline_tools target)
+  foreach(tool ${ARGN})
+    if(NOT TFEL_MATH_ENZYME_${tool})
+      message(FATAL_ERROR "tfel_math_enzyme_generate_optimized_objects: "
+                          "TFEL_MATH_ENZYME_${tool} not found in "
+                          "'${Enzyme_LLVM_BINARY_DIR}/bin', "
+                          "which is required to build target '${target}'")
+    endif()
+  endforeach()
+endfunction()
+
+# generate the object files of the given sources and return their paths
+# in `output`
+function(tfel_math_enzyme_generate_optimized_objects output target)
+  cmake_parse_arguments(TFEL_MATH_ENZYME_GENERATE "LTO" ""
+                        "SOURCES;LINK_LIBRARIES" ${ARGN})
+  if(TFEL_MATH_ENZYME_GENERATE_LTO)
+    tfel_math_enzyme_check_pipeline_tools(${target} OPT LLC LLVM_LINK)
+  else()
+    tfel_math_enzyme_check_pipeline_tools(${target} OPT LLC)
+  endif()
+  set(enzyme_plugin "$<TARGET_FILE:LLVMEnzyme-${Enzyme_LLVM_VERSION_MAJOR}>")
+  set(flags "")
+  foreach(lib ${TFEL_MATH_ENZYME_GENERATE_LINK_LIBRARIES})
+    if(TARGET ${lib})
+      set(includes "$<TARGET_PROPERTY:${lib},INTERFACE_INCLUDE_DIRECTORIES>")
+      set(definitions
+          "$<TARGET_PROPERTY:${lib},INTERFACE_COMPILE_DEFINITIONS>")
+      list(APPEND flags
+           "$<$<BOOL:${includes}>:-I$<JOIN:${includes},$<SEMICOLON>-I>>")
+      list(APPEND flags
+           "$<$<BOOL:${definitions}>:-D$<JOIN:${definitions},$<SEMICOLON>-D>>")
+    endif()
+  endforeach()
+  separate_arguments(cxx_flags NATIVE_COMMAND "${CMAKE_CXX_FLAGS}")
+  set(dir "${CMAKE_CURRENT_BINARY_DIR}/${target}.dir")
+  file(MAKE_DIRECTORY "${dir}")
+  set(ir_files "")
+  set(modules "")
+  foreach(src ${TFEL_MATH_ENZYME_GENERATE_SOURCES})
+    get_filename_component(src "${src}" ABSOLUTE)
+    # the path relative to the source directory is kept in the name of the
+    # module, so that sources sharing the same name do not collide
+    file(RELATIVE_PATH rel "${CMAKE_CURRENT_SOURCE_DIR}" "${src}")
+    string(REPLACE "../" "__/" rel "${rel}")
+    string(REGEX REPLACE "\\.[^./]*$" "" module "${rel}")
+    get_filename_component(rel_dir "${rel}" DIRECTORY)
+    if(rel_dir)
+      file(MAKE_DIRECTORY "${dir}/${rel_dir}")
+    endif()
+    set(ir "${dir}/${module}.ll")
+    # the dependencies on the headers are given by a depfile when the
+    # generator supports it
+    if((CMAKE_GENERATOR MATCHES "Ninja") OR
+       (NOT CMAKE_VERSION VERSION_LESS 3.20))
+      set(depends_options DEPFILE "${ir}.d")
+      set(depends_flags -MD -MF "${ir}.d" -MT "${ir}")
+    else()
+      set(depends_options IMPLICIT_DEPENDS CXX "${src}")
+      set(depends_flags "")
+    endif()
+    add_custom_command(
+      OUTPUT "${ir}"
+      COMMAND ${CMAKE_CXX_COMPILER} ${cxx_flags}
+              -std=c++${CMAKE_CXX_STANDARD} -fPIC
+              ${TFEL_MATH_ENZYME_PRE_ENZYME_FLAGS}
+              ${flags} ${depends_flags}
+              -S -emit-llvm "${src}" -o "${ir}"
+      DEPENDS "${src}"
+      ${depends_options}
+      COMMAND_EXPAND_LISTS
+      COMMENT "Compiling ${rel} to LLVM IR")
+    list(APPEND ir_files "${ir}")
+    list(APPEND modules "${module}")
+  endforeach()
+  if(TFEL_MATH_ENZYME_GENERATE_LTO)
+    # the suffix avoids a collision with a source named after the target
+    set(modules "${target}-lto")
+    add_custom_command(
+      OUTPUT "${dir}/${target}-lto.ll"
+      COMMAND ${TFEL_MATH_ENZYME_LLVM_LINK} -S ${ir_files}
+              -o "${dir}/${target}-lto.ll"
+      DEPENDS ${ir_files}
+      COMMENT "Linking the LLVM IR of ${target}")
+  endif()
+  set(objects "")
+  foreach(module ${modules})
+    set(base "${dir}/${module}")
+    add_custom_command(
+      OUTPUT "${base}-enzyme.ll"
+      COMMAND ${TFEL_MATH_ENZYME_OPT} "${base}.ll"
+              -load-pass-plugin=${enzyme_plugin} --passes=enzyme
+              -S -o "${base}-enzyme.ll"
+      DEPENDS "${base}.ll"
+      COMMENT "Running Enzyme on ${module}")
+    add_custom_command(
+      OUTPUT "${base}-opt.bc"
+      COMMAND ${TFEL_MATH_ENZYME_OPT} "${base}-enzyme.ll"
+              ${TFEL_MATH_ENZYME_POST_ENZYME_FLAGS} -o "${base}-opt.bc"
+      DEPENDS "${base}-enzyme.ll"
+      COMMAND_EXPAND_LISTS
+      COMMENT "Optimising the differentiated IR of ${module}")
+    add_custom_command(
+      OUTPUT "${base}${CMAKE_CXX_OUTPUT_EXTENSION}"
+      COMMAND ${TFEL_MATH_ENZYME_LLC} -O3 -filetype=obj
+              -relocation-model=pic "${base}-opt.bc"
+              -o "${base}${CMAKE_CXX_OUTPUT_EXTENSION}"
+      DEPENDS "${base}-opt.bc"
+      COMMENT "Generating the object file of ${module}")
+    list(APPEND objects "${base}${CMAKE_CXX_OUTPUT_EXTENSION}")
+  endforeach()
+  set_source_files_properties(${objects}
+    PROPERTIES EXTERNAL_OBJECT TRUE GENERATED TRUE)
+  set(${output} ${objects} PARENT_SCOPE)
+endfunction()
+
+function(tfel_math_enzyme_add_optimized_library target)
+  cmake_parse_arguments(TFEL_MATH_ENZYME_OPTIMIZED "STATIC;SHARED;LTO" ""
+                        "SOURCES;LINK_LIBRARIES" ${ARGN})
+  if(NOT TFEL_MATH_ENZYME_OPTIMIZED_SOURCES)
+    message(FATAL_ERROR "tfel_math_enzyme_add_optimized_library: "
+                        "no sources given for target '${target}'")
+  endif()
+  if(TFEL_MATH_ENZYME_OPTIMIZED_LTO)
+    set(lto LTO)
+  else()
+    set(lto "")
+  endif()
+  tfel_math_enzyme_generate_optimized_objects(
+    objects ${target} ${lto}
+    SOURCES ${TFEL_MATH_ENZYME_OPTIMIZED_SOURCES}
+    LINK_LIBRARIES ${TFEL_MATH_ENZYME_OPTIMIZED_LINK_LIBRARIES})
+  if(TFEL_MATH_ENZYME_OPTIMIZED_SHARED)
+    add_library(${target} SHARED ${objects})
+  else()
+    add_library(${target} STATIC ${objects})
+  endif()
+  set_target_properties(${target} PROPERTIES LINKER_LANGUAGE CXX)
+  target_link_libraries(${target} PUBLIC
+                        ${TFEL_MATH_ENZYME_OPTIMIZED_LINK_LIBRARIES})
+endfunction()
+
+function(tfel_math_enzyme_add_optimized_executable target)
+  cmake_parse_arguments(TFEL_MATH_ENZYME_OPTIMIZED "LTO" ""
+                        "SOURCES;LINK_LIBRARIES" ${ARGN})
+  if(NOT TFEL_MATH_ENZYME_OPTIMIZED_SOURCES)
+    message(FATAL_ERROR "tfel_math_enzyme_add_optimized_executable: "
+                        "no sources given for target '${target}'")
+  endif()
+  if(TFEL_MATH_ENZYME_OPTIMIZED_LTO)
+    set(lto LTO)
+  else()
+    set(lto "")
+  endif()
+  tfel_math_enzyme_generate_optimized_objects(
+    objects ${target} ${lto}
+    SOURCES ${TFEL_MATH_ENZYME_OPTIMIZED_SOURCES}
+    LINK_LIBRARIES ${TFEL_MATH_ENZYME_OPTIMIZED_LINK_LIBRARIES})
+  add_executable(${target} ${objects})
+  set_target_properties(${target} PROPERTIES LINKER_LANGUAGE CXX)
+  target_link_libraries(${target} PRIVATE
+                        ${TFEL_MATH_ENZYME_OPTIMIZED_LINK_LIBRARIES})
+endfunction()
@@ -0,0 +1,104 @@
+/*!
+ * \file   TFEL/Math/Enzyme/ActiveCallable.hxx
+ * \brief  This file declares the ActiveCallable class and the associated
+ * functions used to differentiate a callable with respect to the values it
+ * captures
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_ACTIVECALLABLE_HXX
+#define LIB_TFEL_MATH_ENZYME_ACTIVECALLABLE_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief a tag stating that a callable must be differentiated with respect
+   * to the values it holds, such as the material parameters captured by a
+   * \f$\lambda\f$ function.
+   *
+   * The callable is passed to Enzyme as a duplicated argument. Its shadow is
+   * a copy of the callable whose bytes are set to zero, which restricts this
+   * feature to trivially copyable callables holding their parameters by
+   * value.
+   */
+  template <internals::EnzymeCallableConcept CallableType>
+  struct ActiveCallable {
+    //! \brief callable
+    const CallableType& callable;
+  };
+
+  //! \return a tag stating that a callable is active
+  template <internals::EnzymeCallableConcept CallableType>
+  constexpr ActiveCallable<CallableType> active(const CallableType&) noexcept
+      requires(std::is_trivially_copyable_v<CallableType>);
+
+  /*!
+   * \brief a structure holding the derivatives of a callable with respect to
+   * its arguments and to the values it holds.
+   *
+   * An adjoint of the callable is an object of the type of the callable
+   * whose members hold the derivatives with respect to the corresponding
+   * members of the callable. As for the shadows of the arguments, only the
+   * numerical values of those derivatives are meaningful, their units (if
+   * any) being the ones of the members. Callables whose members are public,
+   * rather than \f$\lambda\f$ functions, allow to retrieve them by name.
+   *
+   * If the callable returns a scalar, `CallableAdjointType` is the type of
+   * the callable. If the callable returns a math object, it is an array of
+   * adjoints of the callable, the `i`-th adjoint holding the derivatives of
+   * the `i`-th component of the result.
+   */
+  template <typename DerivativeType, typename CallableAdjointType>
+  struct DerivativeAndCallableAdjoint {
+    //! \brief derivatives with respect to the arguments
+    DerivativeType derivative;
+    //! \brief derivatives with respect to the values held by the callable
+    CallableAdjointType callable_adjoint;
+  };
+
+  /*!
+   * \brief compute the derivatives of a callable with respect to the
+   * variables designated by the indices `idx` and to the values held by the
+   * callable.
+   *
+   * A single reverse pass is used if the callable returns a scalar.
+   * Otherwise, one reverse pass is used per block of `maximumVectorWidth`
+   * components of the result, and the adjoints of the callable are
+   * returned in an array indexed by the components of the result, e.g. the
+   * derivatives of the stress with respect to the Young modulus captured
+   * by a callable computing the stress.
+   *
+   * \tparam idx: indices of the variables. If no index is given, all the
+   * arguments are considered.
+   * \param[in] c: active callable
+   * \param[in] args: arguments passed to the callable
+   */
+  template <std::size_t... idx,
+            typename CallableType,
+            typename... ArgumentsTypes>
+  auto computeReverseModeDerivative(const ActiveCallable<CallableType>&,
+                                    ArgumentsTypes&&...)  //
+      requires((sizeof...(ArgumentsTypes) > 0) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/ActiveCallable.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_ACTIVECALLABLE_HXX */
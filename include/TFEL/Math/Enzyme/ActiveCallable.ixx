@@ -0,0 +1,254 @@
+/*!
+ * \file   TFEL/Math/Enzyme/ActiveCallable.ixx
+ * \brief  This file implements the functions used to differentiate a
+ * callable with respect to the values it captures
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_ACTIVECALLABLE_IXX
+#define LIB_TFEL_MATH_ENZYME_ACTIVECALLABLE_IXX
+
+#include <array>
+#include <tuple>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/Internals/ActiveArguments.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \return a copy of a callable whose bytes are set to zero
+  template <typename CallableType>
+  CallableType makeCallableShadow(const CallableType& c) {
+    static_assert(std::is_trivially_copyable_v<CallableType>);
+    auto s = c;
+    std::memset(static_cast<void*>(&s), 0, sizeof(CallableType));
+    return s;
+  }  // end of makeCallableShadow
+
+  //! \return `N` copies of a callable whose bytes are set to zero
+  template <std::size_t N, typename CallableType>
+  std::array<CallableType, N> makeCallableShadows(const CallableType& c) {
+    return [&c]<std::size_t... i>(const std::index_sequence<i...>&) {
+      return std::array<CallableType, N>{
+          (static_cast<void>(i), makeCallableShadow(c))...};
+    }
+    (std::make_index_sequence<N>{});
+  }  // end of makeCallableShadows
+
+  /*!
+   * \brief copy the shadows of the active arguments, i.e. the gradients of
+   * the `i`-th component of the result of a callable, in the `i`-th rows of
+   * the derivatives.
+   * \param[out] r: derivative or packed derivatives
+   * \param[in] i: index of the row
+   * \param[in] dx: shadows of the active arguments
+   */
+  template <typename DerivativeType, typename ActiveArgumentsType>
+  void setDerivativesRows(DerivativeType& r,
+                          const std::size_t i,
+                          const ActiveArgumentsType& dx) {
+    if constexpr (std::tuple_size_v<ActiveArgumentsType> == 1) {
+      setDerivativeRow(r, i, std::get<0>(dx));
+    } else {
+      [&r, i, &dx ]<std::size_t... k>(const std::index_sequence<k...>&) {
+        (setDerivativeRow(get<k>(r), i, std::get<k>(dx)), ...);
+      }
+      (std::make_index_sequence<std::tuple_size_v<ActiveArgumentsType>>{});
+    }
+  }  // end of setDerivativesRows
+
+  /*!
+   * \brief compute the rows `offset` to `offset + w` of the derivatives of
+   * a callable returning a math object with respect to the active arguments
+   * and the associated adjoints of the callable, using Enzyme's vector
+   * reverse mode, where `w` is bounded by `maximumVectorWidth`.
+   *
+   * \param[out] r: derivatives with respect to the active arguments
+   * \param[out] dc: adjoints of the callable, one per component of the
+   * result
+   * \param[in] c: callable
+   * \param[in] x: active arguments
+   * \param[in] v: values of all the arguments
+   */
+  template <std::size_t offset,
+            std::size_t... idx,
+            typename DerivativeType,
+            std::size_t N,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename ActiveArgumentsType,
+            typename ArgumentsValuesType>
+  void computeReverseModeDerivativeRowsAndCallableAdjoints(
+      DerivativeType& r,
+      std::array<CallableType, N>& dc,
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>& args_list,
+      const ActiveArgumentsType& x,
+      const ArgumentsValuesType& v) {
+    using ResultType =
+        std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    constexpr auto w = std::min(N - offset, maximumVectorWidth);
+    auto dr = std::array<ResultType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      setUnitSeed(dr[k], offset + k);
+    }
+    auto dx = std::array<ActiveArgumentsType, w>{};
+    auto value = ResultType{};
+    auto wrapper = [](const CallableType* const wc,
+                      const ActiveArgumentsType* const wx,
+                      const ArgumentsValuesType* const wv,
+                      ResultType* const wr) {
+      *wr = callWithActiveArguments<idx...>(
+          *wc, TypeList<CallableArgumentsTypes...>{}, *wx, *wv,
+          std::make_index_sequence<sizeof...(CallableArgumentsTypes)>{});
+    };
+    void* const wrapper_ptr = reinterpret_cast<void*>(+wrapper);
+    const void* const c_ptr = reinterpret_cast<const void*>(&c);
+    [&]<std::size_t... k>(const std::index_sequence<k...>&) {
+      __enzyme_autodiff<void>(
+          wrapper_ptr, enzyme_width, static_cast<int>(w),                  //
+          enzyme_dup, c_ptr, reinterpret_cast<void*>(&dc[offset + k])...,  //
+          enzyme_dup, &x, &dx[k]...,                                       //
+          enzyme_const, &v,                                                //
+          enzyme_dup, &value, &dr[k]...);
+    }
+    (std::make_index_sequence<w>{});
+    for (std::size_t k = 0; k != w; ++k) {
+      setDerivativesRows(r, offset + k, dx[k]);
+    }
+    if constexpr (offset + w < N) {
+      computeReverseModeDerivativeRowsAndCallableAdjoints<offset + w, idx...>(
+          r, dc, c, args_list, x, v);
+    }
+  }  // end of computeReverseModeDerivativeRowsAndCallableAdjoints
+
+  /*!
+   * \brief compute the derivatives of a callable with respect to the
+   * variables `idx` and to the values it holds.
+   *
+   * For a callable returning a scalar, this function follows
+   * `computeReverseModeScalarFunctionDerivative`, the callable being passed
+   * as a duplicated argument rather than as a constant one. For a callable
+   * returning a math object, one reverse pass is performed per block of
+   * `maximumVectorWidth` components of the result.
+   */
+  template <std::size_t... idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeReverseModeDerivativeAndCallableAdjoint(
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>&,
+      ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (sizeof...(idx) > 0)) {
+    using CallableResultType =
+        std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    using ArgumentsValuesType =
+        std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<idx, ArgumentsValuesType>...>;
+    static_assert((isConvertible<ArgumentsTypes, CallableArgumentsTypes>() &&
+                   ...),
+                  "arguments are not compatible with the arguments of the "
+                  "callable");
+    checkRedundancy<sizeof...(ArgumentsTypes) - 1, idx...>();
+    using DerivativeType = std::conditional_t<
+        sizeof...(idx) == 1,
+        derivative_type<CallableResultType,
+                        std::tuple_element_t<0, ActiveArgumentsType>>,
+        PackedDerivatives<derivative_type<
+            CallableResultType,
+            std::tuple_element_t<idx, ArgumentsValuesType>>...>>;
+    const auto v = ArgumentsValuesType{
+        static_cast<std::decay_t<CallableArgumentsTypes>>(args)...};
+    const auto x = ActiveArgumentsType{std::get<idx>(v)...};
+    if constexpr (ScalarConcept<CallableResultType>) {
+      auto dx = ActiveArgumentsType{};
+      auto dc = makeCallableShadow(c);
+      auto wrapper = [](const CallableType* const wc,
+                        const ActiveArgumentsType* const wx,
+                        const ArgumentsValuesType* const wv) {
+        return callWithActiveArguments<idx...>(
+            *wc, TypeList<CallableArgumentsTypes...>{}, *wx, *wv,
+            std::make_index_sequence<sizeof...(CallableArgumentsTypes)>{});
+      };
+      void* const wrapper_ptr = reinterpret_cast<void*>(+wrapper);
+      const void* const c_ptr = reinterpret_cast<const void*>(&c);
+      void* const dc_ptr = reinterpret_cast<void*>(&dc);
+      __enzyme_autodiff<void>(wrapper_ptr,                 //
+                              enzyme_dup, c_ptr, dc_ptr,  //
+                              enzyme_dup, &x, &dx,        //
+                              enzyme_const, &v);
+      if constexpr (sizeof...(idx) == 1) {
+        return DerivativeAndCallableAdjoint<DerivativeType, CallableType>{
+            .derivative = convertShadow<DerivativeType>(std::get<0>(dx)),
+            .callable_adjoint = dc};
+      } else {
+        auto r = DerivativeType{};
+        convertShadows(r, dx, std::make_index_sequence<sizeof...(idx)>{});
+        return DerivativeAndCallableAdjoint<DerivativeType, CallableType>{
+            .derivative = r, .callable_adjoint = dc};
+      }
+    } else {
+      constexpr auto n = getVariableSize<CallableResultType>();
+      using CallableAdjointType = std::array<CallableType, n>;
+      auto r = DerivativeType{};
+      auto dc = makeCallableShadows<n>(c);
+      computeReverseModeDerivativeRowsAndCallableAdjoints<0, idx...>(
+          r, dc, c, TypeList<CallableArgumentsTypes...>{}, x, v);
+      return DerivativeAndCallableAdjoint<DerivativeType,
+                                          CallableAdjointType>{
+          .derivative = r, .callable_adjoint = dc};
+    }
+  }  // end of computeReverseModeDerivativeAndCallableAdjoint
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType>
+  constexpr ActiveCallable<CallableType> active(const CallableType& c) noexcept
+      requires(std::is_trivially_copyable_v<CallableType>) {
+    return ActiveCallable<CallableType>{c};
+  }  // end of active
+
+  template <std::size_t... idx,
+            typename CallableType,
+            typename... ArgumentsTypes>
+  auto computeReverseModeDerivative(const ActiveCallable<CallableType>& ac,
+                                    ArgumentsTypes&&... args)  //
+      requires((sizeof...(ArgumentsTypes) > 0) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      return [&ac, &args...]<std::size_t... i>(
+          const std::index_sequence<i...>&) {
+        return internals::computeReverseModeDerivativeAndCallableAdjoint<i...>(
+            ac.callable, internals::getArgumentsList<CallableType>(),
+            std::forward<ArgumentsTypes>(args)...);
+      }
+      (std::index_sequence_for<ArgumentsTypes...>{});
+    } else {
+      return internals::computeReverseModeDerivativeAndCallableAdjoint<idx...>(
+          ac.callable, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    }
+  }  // end of computeReverseModeDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_ACTIVECALLABLE_IXX */
@@ -0,0 +1,68 @@
+/*!
+ * \file   TFEL/Math/Enzyme/CustomDerivatives.hxx
+ * \brief  This file declares macros used to attach hand-written derivatives
+ * to a function
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_CUSTOMDERIVATIVES_HXX
+#define LIB_TFEL_MATH_ENZYME_CUSTOMDERIVATIVES_HXX
+
+/*!
+ * \brief register the forward mode derivative of a function.
+ *
+ * Enzyme replaces the differentiation of the calls to the function `F` by
+ * calls to `DF`. The arguments of `DF` are the arguments of `F`, each
+ * duplicated argument being followed by its shadow.
+ *
+ * \param[in] ID: identifier of the registration, which must be unique
+ * \param[in] F: function. Template instances must be enclosed in
+ * parentheses
+ * \param[in] DF: forward mode derivative
+ *
+ * \note this macro must be used at global scope. The function `F` must not
+ * be inlined, which is ensured by the `TFEL_MATH_ENZYME_NOINLINE` macro.
+ */
+#define TFEL_MATH_ENZYME_REGISTER_FORWARD_MODE_DERIVATIVE(ID, F, DF) \
+  [[gnu::used]] inline void* __enzyme_register_derivative_##ID[2] = { \
+      reinterpret_cast<void*>(F), reinterpret_cast<void*>(DF)}
+
+/*!
+ * \brief register the reverse mode derivative of a function.
+ *
+ * The augmented forward function `AF` has the arguments of the forward mode
+ * derivative. It evaluates the function and returns a tape, which may be a
+ * null pointer. The reverse function `RF` takes the same arguments followed
+ * by the tape and accumulates the adjoints of the inputs in their shadows.
+ *
+ * \param[in] ID: identifier of the registration, which must be unique
+ * \param[in] F: function
+ * \param[in] AF: augmented forward function
+ * \param[in] RF: reverse function
+ *
+ * \note this macro must be used at global scope.
+ */
+#define TFEL_MATH_ENZYME_REGISTER_REVERSE_MODE_DERIVATIVE(ID, F, AF, RF) \
+  [[gnu::used]] inline void* __enzyme_register_gradient_##ID[3] = {     \
+      reinterpret_cast<void*>(F), reinterpret_cast<void*>(AF),          \
+      reinterpret_cast<void*>(RF)}
+
+//! \brief register both the forward and reverse mode derivatives
+#define TFEL_MATH_ENZYME_REGISTER_CUSTOM_DERIVATIVES(ID, F, DF, AF, RF) \
+  TFEL_MATH_ENZYME_REGISTER_FORWARD_MODE_DERIVATIVE(ID, F, DF);        \
+  TFEL_MATH_ENZYME_REGISTER_REVERSE_MODE_DERIVATIVE(ID, F, AF, RF)
+
+/*!
+ * \brief attribute preventing a function with custom derivatives from
+ * being inlined before Enzyme's differentiation pass.
+ */
+#define TFEL_MATH_ENZYME_NOINLINE [[gnu::noinline]]
+
+#endif /* LIB_TFEL_MATH_ENZYME_CUSTOMDERIVATIVES_HXX */
@@ -0,0 +1,80 @@
+/*!
+ * \file   TFEL/Math/Enzyme/DefineDerivativeKernel.hxx
+ * \brief  This file declares the macro used to define derivative kernels
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_DEFINEDERIVATIVEKERNEL_HXX
+#define LIB_TFEL_MATH_ENZYME_DEFINEDERIVATIVEKERNEL_HXX
+
+#include <utility>
+#include "TFEL/Math/Enzyme/DerivativeKernel.hxx"
+#include "TFEL/Math/Enzyme/getDerivativeFunction.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \return the derivative of order `sizeof...(i)` of a free function of
+   * one variable.
+   * \tparam m: differentiation mode
+   * \tparam F: function
+   * \param[in] x: value of the variable
+   */
+  template <Mode m,
+            IsFunctionPointerConcept auto F,
+            typename VariableType,
+            std::size_t... i>
+  auto computeDerivativeKernel(const VariableType& x,
+                               const std::index_sequence<i...>&) {
+    const auto d = getDerivativeFunction<m, (0 * i)...>(function<F>);
+    return d(x);
+  }  // end of computeDerivativeKernel
+
+}  // end of namespace tfel::math::enzyme::internals
+
+/*!
+ * \brief define a derivative kernel declared by the
+ * `TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL` macro, using the given
+ * differentiation mode.
+ *
+ * This macro is meant to be used in only one source file, compiled with
+ * Enzyme, for example in a library shared by all the translation units
+ * using the kernel.
+ *
+ * \param[in] NAME: name of the kernel
+ * \param[in] F: function, which must not be overloaded
+ * \param[in] ORDER: order of the derivative
+ * \param[in] MODE: differentiation mode
+ */
+#define TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL_WITH_MODE(NAME, F, ORDER,  \
+                                                            MODE)            \
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(NAME, F, ORDER);               \
+  typename ::tfel::math::enzyme::internals::DerivativeKernelTraits<          \
+      decltype(F), ORDER>::result_type                                       \
+  NAME(const typename ::tfel::math::enzyme::internals::                      \
+           DerivativeKernelTraits<decltype(F), ORDER>::variable_type& x) {   \
+    return ::tfel::math::enzyme::internals::computeDerivativeKernel<MODE,    \
+                                                                    &F>(     \
+        x, std::make_index_sequence<ORDER>{});                               \
+  }
+
+/*!
+ * \brief define a derivative kernel declared by the
+ * `TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL` macro, the differentiation
+ * mode being selected automatically.
+ * \param[in] NAME: name of the kernel
+ * \param[in] F: function, which must not be overloaded
+ * \param[in] ORDER: order of the derivative
+ */
+#define TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(NAME, F, ORDER) \
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL_WITH_MODE(              \
+      NAME, F, ORDER, ::tfel::math::enzyme::Mode::AUTO)
+
+#endif /* LIB_TFEL_MATH_ENZYME_DEFINEDERIVATIVEKERNEL_HXX */
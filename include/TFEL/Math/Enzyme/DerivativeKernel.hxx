@@ -0,0 +1,83 @@
+/*!
+ * \file   TFEL/Math/Enzyme/DerivativeKernel.hxx
+ * \brief  This file declares the macro used to declare derivative kernels
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_DERIVATIVEKERNEL_HXX
+#define LIB_TFEL_MATH_ENZYME_DERIVATIVEKERNEL_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/General/DerivativeType.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief traits class describing the derivative of order `order` of a
+   * free function of one variable.
+   * \tparam FunctionType: type of the function
+   * \tparam order: order of the derivative
+   */
+  template <typename FunctionType, std::size_t order>
+  struct DerivativeKernelTraits;
+
+  //! \brief partial specialisation for derivatives of order 1
+  template <typename ResultType, typename ArgumentType>
+  struct DerivativeKernelTraits<ResultType(ArgumentType), 1> {
+    //! \brief type of the variable
+    using variable_type = std::decay_t<ArgumentType>;
+    //! \brief type of the derivative
+    using result_type = derivative_type<std::decay_t<ResultType>, variable_type>;
+  };
+
+  //! \brief partial specialisation for derivatives of higher orders
+  template <typename ResultType, typename ArgumentType, std::size_t order>
+  requires(order > 1) struct DerivativeKernelTraits<ResultType(ArgumentType),
+                                                    order> {
+    //! \brief type of the variable
+    using variable_type = std::decay_t<ArgumentType>;
+    //! \brief type of the derivative
+    using result_type = derivative_type<
+        typename DerivativeKernelTraits<ResultType(ArgumentType),
+                                        order - 1>::result_type,
+        variable_type>;
+  };
+
+}  // end of namespace tfel::math::enzyme::internals
+
+/*!
+ * \brief declare a derivative kernel, i.e. a function computing the
+ * derivative of order `ORDER` of the free function `F` of one variable.
+ *
+ * The declaration only requires the declaration of `F`: translation units
+ * using the kernel do not include the headers of `TFELMathEnzyme` computing
+ * derivatives and are not processed by Enzyme. The kernel is defined once
+ * using the `TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL` macro.
+ *
+ * \param[in] NAME: name of the kernel
+ * \param[in] F: function, which must not be overloaded
+ * \param[in] ORDER: order of the derivative
+ *
+ * For instance:
+ *
+ * \code{.cpp}
+ * double computeVonMisesStress(const stensor<3u, double>&);
+ * TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+ *                                            computeVonMisesStress, 1);
+ * \endcode
+ */
+#define TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(NAME, F, ORDER)      \
+  typename ::tfel::math::enzyme::internals::DerivativeKernelTraits<     \
+      decltype(F), ORDER>::result_type                                  \
+  NAME(const typename ::tfel::math::enzyme::internals::                 \
+           DerivativeKernelTraits<decltype(F), ORDER>::variable_type&)
+
+#endif /* LIB_TFEL_MATH_ENZYME_DERIVATIVEKERNEL_HXX */
@@ -0,0 +1,59 @@
+/*!
+ * \file   TFEL/Math/Enzyme/EigenSolvers.hxx
+ * \brief  This file declares versions of the eigen solvers of symmetric
+ * tensors with custom derivatives
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_EIGENSOLVERS_HXX
+#define LIB_TFEL_MATH_ENZYME_EIGENSOLVERS_HXX
+
+#include <array>
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Enzyme/CustomDerivatives.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the eigen values of a symmetric tensor.
+   *
+   * Contrary to the `computeEigenValues` method of the `stensor` class, Enzyme
+   * does not differentiate the iterations of the eigen solver: the
+   * derivative of the `i`-th eigen value is given by the `i`-th eigen tensor.
+   *
+   * \tparam es: eigen solver
+   * \tparam N: space dimension
+   * \param[in] s: symmetric tensor
+   */
+  template <stensor_common::EigenSolver es = stensor_common::TFELEIGENSOLVER,
+            unsigned short N>
+  tvector<3u, double> computeEigenValues(const stensor<N, double>&);
+  /*!
+   * \brief compute the eigen tensors of a symmetric tensor.
+   *
+   * The derivatives of the eigen tensors are computed by the
+   * `computeEigenTensorsDerivatives` method of the `stensor` class rather
+   * than by differentiating the iterations of the eigen solver.
+   *
+   * \tparam es: eigen solver
+   * \tparam N: space dimension
+   * \param[in] s: symmetric tensor
+   */
+  template <stensor_common::EigenSolver es = stensor_common::TFELEIGENSOLVER,
+            unsigned short N>
+  std::array<stensor<N, double>, 3u> computeEigenTensors(
+      const stensor<N, double>&);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/EigenSolvers.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_EIGENSOLVERS_HXX */
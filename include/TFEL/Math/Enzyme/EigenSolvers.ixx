@@ -0,0 +1,258 @@
+/*!
+ * \file   TFEL/Math/Enzyme/EigenSolvers.ixx
+ * \brief  This file implements the eigen solvers of symmetric tensors with
+ * custom derivatives and registers those derivatives
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_EIGENSOLVERS_IXX
+#define LIB_TFEL_MATH_ENZYME_EIGENSOLVERS_IXX
+
+#include <cmath>
+#include <limits>
+#include <cstddef>
+#include <algorithm>
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/Enzyme/Variable.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \brief number of components of a symmetric tensor
+  template <unsigned short N>
+  inline constexpr std::size_t stensorSize =
+      getVariableSize<stensor<N, double>>();
+
+  //! \return a symmetric tensor built from its components
+  template <unsigned short N>
+  stensor<N, double> makeStensor(const double* const s) {
+    auto r = stensor<N, double>{};
+    for (std::size_t i = 0; i != stensorSize<N>; ++i) {
+      r[static_cast<unsigned short>(i)] = s[i];
+    }
+    return r;
+  }  // end of makeStensor
+
+  //! \return the threshold below which two eigen values are considered equal
+  inline double getEigenValuesTolerance(const tvector<3u, double>& vp) {
+    const auto m = std::max({std::abs(vp(0)), std::abs(vp(1)),
+                             std::abs(vp(2)), double{1}});
+    return 10 * std::numeric_limits<double>::epsilon() * m;
+  }  // end of getEigenValuesTolerance
+
+  /*!
+   * \brief compute the eigen values of a symmetric tensor
+   * \param[out] vp: eigen values
+   * \param[in] s: components of the symmetric tensor
+   */
+  template <stensor_common::EigenSolver es, unsigned short N>
+  TFEL_MATH_ENZYME_NOINLINE void computeEigenValuesKernel(
+      double* const vp, const double* const s) {
+    const auto v = makeStensor<N>(s).template computeEigenValues<es>();
+    for (unsigned short i = 0; i != 3; ++i) {
+      vp[i] = v(i);
+    }
+  }  // end of computeEigenValuesKernel
+
+  //! \brief forward mode derivative of `computeEigenValuesKernel`
+  template <stensor_common::EigenSolver es, unsigned short N>
+  void computeEigenValuesForwardModeDerivative(double* const vp,
+                                               double* const dvp,
+                                               const double* const s,
+                                               const double* const ds) {
+    const auto [v, m] = makeStensor<N>(s).template computeEigenVectors<es>();
+    const auto [n0, n1, n2] = stensor<N, double>::computeEigenTensors(m);
+    const auto dst = makeStensor<N>(ds);
+    for (unsigned short i = 0; i != 3; ++i) {
+      vp[i] = v(i);
+    }
+    dvp[0] = n0 | dst;
+    dvp[1] = n1 | dst;
+    dvp[2] = n2 | dst;
+  }  // end of computeEigenValuesForwardModeDerivative
+
+  //! \brief augmented forward pass of `computeEigenValuesKernel`
+  template <stensor_common::EigenSolver es, unsigned short N>
+  void* computeEigenValuesAugmentedForwardPass(double* const vp,
+                                               double* const,
+                                               const double* const s,
+                                               double* const) {
+    computeEigenValuesKernel<es, N>(vp, s);
+    return nullptr;
+  }  // end of computeEigenValuesAugmentedForwardPass
+
+  //! \brief reverse mode derivative of `computeEigenValuesKernel`
+  template <stensor_common::EigenSolver es, unsigned short N>
+  void computeEigenValuesReverseModeDerivative(double* const,
+                                               double* const dvp,
+                                               const double* const s,
+                                               double* const ds,
+                                               void* const) {
+    const auto [v, m] = makeStensor<N>(s).template computeEigenVectors<es>();
+    const auto [n0, n1, n2] = stensor<N, double>::computeEigenTensors(m);
+    for (std::size_t i = 0; i != stensorSize<N>; ++i) {
+      const auto j = static_cast<unsigned short>(i);
+      ds[i] += dvp[0] * n0[j] + dvp[1] * n1[j] + dvp[2] * n2[j];
+    }
+    dvp[0] = dvp[1] = dvp[2] = double{0};
+    static_cast<void>(v);
+  }  // end of computeEigenValuesReverseModeDerivative
+
+  /*!
+   * \brief compute the eigen tensors of a symmetric tensor
+   * \param[out] n: components of the three eigen tensors, stored
+   * contiguously
+   * \param[in] s: components of the symmetric tensor
+   */
+  template <stensor_common::EigenSolver es, unsigned short N>
+  TFEL_MATH_ENZYME_NOINLINE void computeEigenTensorsKernel(
+      double* const n, const double* const s) {
+    constexpr auto ns = stensorSize<N>;
+    const auto [v, m] = makeStensor<N>(s).template computeEigenVectors<es>();
+    const auto [n0, n1, n2] = stensor<N, double>::computeEigenTensors(m);
+    for (std::size_t i = 0; i != ns; ++i) {
+      const auto j = static_cast<unsigned short>(i);
+      n[i] = n0[j];
+      n[ns + i] = n1[j];
+      n[2 * ns + i] = n2[j];
+    }
+    static_cast<void>(v);
+  }  // end of computeEigenTensorsKernel
+
+  //! \brief derivatives of the eigen tensors of a symmetric tensor
+  template <stensor_common::EigenSolver es, unsigned short N>
+  std::array<st2tost2<N, double>, 3u> computeEigenTensorsDerivatives(
+      const double* const s) {
+    auto dn = std::array<st2tost2<N, double>, 3u>{};
+    const auto [v, m] = makeStensor<N>(s).template computeEigenVectors<es>();
+    stensor<N, double>::computeEigenTensorsDerivatives(
+        dn[0], dn[1], dn[2], v, m, getEigenValuesTolerance(v));
+    return dn;
+  }  // end of computeEigenTensorsDerivatives
+
+  //! \brief forward mode derivative of `computeEigenTensorsKernel`
+  template <stensor_common::EigenSolver es, unsigned short N>
+  void computeEigenTensorsForwardModeDerivative(double* const n,
+                                                double* const dn,
+                                                const double* const s,
+                                                const double* const ds) {
+    constexpr auto ns = stensorSize<N>;
+    computeEigenTensorsKernel<es, N>(n, s);
+    const auto dn_ds = computeEigenTensorsDerivatives<es, N>(s);
+    const auto dst = makeStensor<N>(ds);
+    for (std::size_t k = 0; k != 3; ++k) {
+      const stensor<N, double> dnk = dn_ds[k] * dst;
+      for (std::size_t i = 0; i != ns; ++i) {
+        dn[k * ns + i] = dnk[static_cast<unsigned short>(i)];
+      }
+    }
+  }  // end of computeEigenTensorsForwardModeDerivative
+
+  //! \brief augmented forward pass of `computeEigenTensorsKernel`
+  template <stensor_common::EigenSolver es, unsigned short N>
+  void* computeEigenTensorsAugmentedForwardPass(double* const n,
+                                                double* const,
+                                                const double* const s,
+                                                double* const) {
+    computeEigenTensorsKernel<es, N>(n, s);
+    return nullptr;
+  }  // end of computeEigenTensorsAugmentedForwardPass
+
+  //! \brief reverse mode derivative of `computeEigenTensorsKernel`
+  template <stensor_common::EigenSolver es, unsigned short N>
+  void computeEigenTensorsReverseModeDerivative(double* const,
+                                                double* const dn,
+                                                const double* const s,
+                                                double* const ds,
+                                                void* const) {
+    constexpr auto ns = stensorSize<N>;
+    const auto dn_ds = computeEigenTensorsDerivatives<es, N>(s);
+    for (std::size_t k = 0; k != 3; ++k) {
+      const stensor<N, double> dsk = makeStensor<N>(dn + k * ns) * dn_ds[k];
+      for (std::size_t i = 0; i != ns; ++i) {
+        ds[i] += dsk[static_cast<unsigned short>(i)];
+        dn[k * ns + i] = double{0};
+      }
+    }
+  }  // end of computeEigenTensorsReverseModeDerivative
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <stensor_common::EigenSolver es, unsigned short N>
+  tvector<3u, double> computeEigenValues(const stensor<N, double>& s) {
+    auto vp = tvector<3u, double>{};
+    internals::computeEigenValuesKernel<es, N>(vp.data(), s.data());
+    return vp;
+  }  // end of computeEigenValues
+
+  template <stensor_common::EigenSolver es, unsigned short N>
+  std::array<stensor<N, double>, 3u> computeEigenTensors(
+      const stensor<N, double>& s) {
+    constexpr auto ns = internals::stensorSize<N>;
+    double n[3 * ns];
+    internals::computeEigenTensorsKernel<es, N>(n, s.data());
+    auto r = std::array<stensor<N, double>, 3u>{};
+    for (std::size_t k = 0; k != 3; ++k) {
+      r[k] = internals::makeStensor<N>(n + k * ns);
+    }
+    return r;
+  }  // end of computeEigenTensors
+
+}  // end of namespace tfel::math::enzyme
+
+//! \brief register the derivatives of the eigen solvers
+#define TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES(ES, N)          \
+  TFEL_MATH_ENZYME_REGISTER_CUSTOM_DERIVATIVES(                            \
+      tfel_math_enzyme_eigen_values_##ES##_##N,                            \
+      (&tfel::math::enzyme::internals::computeEigenValuesKernel<           \
+          tfel::math::stensor_common::ES, N>),                             \
+      (&tfel::math::enzyme::internals::                                    \
+           computeEigenValuesForwardModeDerivative<                        \
+               tfel::math::stensor_common::ES, N>),                        \
+      (&tfel::math::enzyme::internals::                                    \
+           computeEigenValuesAugmentedForwardPass<                         \
+               tfel::math::stensor_common::ES, N>),                        \
+      (&tfel::math::enzyme::internals::                                    \
+           computeEigenValuesReverseModeDerivative<                        \
+               tfel::math::stensor_common::ES, N>));                       \
+  TFEL_MATH_ENZYME_REGISTER_CUSTOM_DERIVATIVES(                            \
+      tfel_math_enzyme_eigen_tensors_##ES##_##N,                           \
+      (&tfel::math::enzyme::internals::computeEigenTensorsKernel<          \
+          tfel::math::stensor_common::ES, N>),                             \
+      (&tfel::math::enzyme::internals::                                    \
+           computeEigenTensorsForwardModeDerivative<                       \
+               tfel::math::stensor_common::ES, N>),                        \
+      (&tfel::math::enzyme::internals::                                    \
+           computeEigenTensorsAugmentedForwardPass<                        \
+               tfel::math::stensor_common::ES, N>),                        \
+      (&tfel::math::enzyme::internals::                                    \
+           computeEigenTensorsReverseModeDerivative<                       \
+               tfel::math::stensor_common::ES, N>))
+
+#define TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(ES) \
+  TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES(ES, 1);    \
+  TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES(ES, 2);    \
+  TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES(ES, 3)
+
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(TFELEIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(FSESJACOBIEIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(FSESQLEIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(FSESCUPPENEIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(FSESHYBRIDEIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(FSESANALYTICALEIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(GTESYMMETRICQREIGENSOLVER);
+TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2(HARARIEIGENSOLVER);
+
+#undef TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES2
+#undef TFEL_MATH_ENZYME_REGISTER_EIGEN_SOLVER_DERIVATIVES
+
+#endif /* LIB_TFEL_MATH_ENZYME_EIGENSOLVERS_IXX */
@@ -0,0 +1,160 @@
+/*!
+ * \file   TFEL/Math/Enzyme/Internals/ActiveArguments.hxx
+ * \brief  This header introduces helper functions used to differentiate a
+ * callable with respect to a subset of its arguments, called the active
+ * arguments, which are packed in a tuple.
+ * \author Thomas Helfer
+ * \date   19/08/2024
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_INTERNALS_ACTIVEARGUMENTS_HXX
+#define LIB_TFEL_MATH_ENZYME_INTERNALS_ACTIVEARGUMENTS_HXX
+
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/TypeList.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \brief check that the indices `idx` lower than `N` are not repeated
+  template <std::size_t N, std::size_t... idx>
+  constexpr void checkRedundancy() noexcept requires(sizeof...(idx) > 0) {
+    const auto n = (((idx == N) ? 1 : 0) + ...);
+    static_assert(n < 2, "redundant indices detected");
+    if constexpr (N > 0) {
+      return checkRedundancy<N - 1, idx...>();
+    }
+  }
+
+  //! \return the position of `i` in the list of indices `idx`
+  template <std::size_t i, std::size_t... idx>
+  constexpr std::size_t getActiveArgumentPosition() noexcept {
+    constexpr auto indices = std::array<std::size_t, sizeof...(idx)>{idx...};
+    return static_cast<std::size_t>(
+        std::find(indices.begin(), indices.end(), i) - indices.begin());
+  }  // end of getActiveArgumentPosition
+
+  /*!
+   * \return the `i`-th argument of a callable, which is taken in the active
+   * arguments if `i` belongs to `idx` and in the values of all arguments
+   * otherwise.
+   * \param[in] x: active arguments
+   * \param[in] v: values of all the arguments
+   */
+  template <std::size_t i,
+            std::size_t... idx,
+            typename ActiveArgumentsType,
+            typename ArgumentsValuesType>
+  const auto& selectActiveArgument(const ActiveArgumentsType& x,
+                             const ArgumentsValuesType& v) noexcept {
+    if constexpr (((i == idx) || ...)) {
+      return std::get<getActiveArgumentPosition<i, idx...>()>(x);
+    } else {
+      return std::get<i>(v);
+    }
+  }  // end of selectActiveArgument
+
+  /*!
+   * \brief call a callable, the arguments designated by `idx` being taken
+   * in the active arguments.
+   * \param[in] c: callable
+   * \param[in] x: active arguments
+   * \param[in] v: values of all the arguments
+   */
+  template <std::size_t... idx,
+            typename CallableType,
+            typename... CallableArgumentsTypes,
+            typename ActiveArgumentsType,
+            typename ArgumentsValuesType,
+            std::size_t... i>
+  auto callWithActiveArguments(const CallableType& c,
+                               const TypeList<CallableArgumentsTypes...>&,
+                               const ActiveArgumentsType& x,
+                               const ArgumentsValuesType& v,
+                               const std::index_sequence<i...>&) {
+    return c(static_cast<CallableArgumentsTypes>(
+        selectActiveArgument<i, idx...>(x, v))...);
+  }  // end of callWithActiveArguments
+
+  /*!
+   * \return a callable of the active arguments only, the other arguments
+   * being bound to the given values.
+   * \param[in] c: callable
+   * \param[in] v: values of all the arguments
+   * \note the callable and the values are captured by reference
+   */
+  template <std::size_t... idx,
+            typename CallableType,
+            typename... CallableArgumentsTypes,
+            typename ArgumentsValuesType>
+  auto bindInactiveArguments(const CallableType& c,
+                             const TypeList<CallableArgumentsTypes...>&,
+                             const ArgumentsValuesType& v) {
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<idx, ArgumentsValuesType>...>;
+    return [&c, &v](const ActiveArgumentsType& x) {
+      return callWithActiveArguments<idx...>(
+          c, TypeList<CallableArgumentsTypes...>{}, x, v,
+          std::make_index_sequence<sizeof...(CallableArgumentsTypes)>{});
+    };
+  }  // end of bindInactiveArguments
+
+  //! \return the total number of components of the active arguments
+  template <typename ActiveArgumentsType>
+  constexpr std::size_t getActiveArgumentsSize() noexcept {
+    return []<std::size_t... i>(const std::index_sequence<i...>&) {
+      return (
+          getVariableSize<std::tuple_element_t<i, ActiveArgumentsType>>() +
+          ...);
+    }
+    (std::make_index_sequence<std::tuple_size_v<ActiveArgumentsType>>{});
+  }  // end of getActiveArgumentsSize
+
+  /*!
+   * \return the offset of the first component of the `i`-th active argument
+   * in the list of all the components of the active arguments.
+   */
+  template <std::size_t i, typename ActiveArgumentsType>
+  constexpr std::size_t getActiveArgumentOffset() noexcept {
+    return []<std::size_t... j>(const std::index_sequence<j...>&) {
+      return (
+          std::size_t{0} + ... +
+          getVariableSize<std::tuple_element_t<j, ActiveArgumentsType>>());
+    }
+    (std::make_index_sequence<i>{});
+  }  // end of getActiveArgumentOffset
+
+  /*!
+   * \brief set the `g`-th component of the active arguments to one.
+   *
+   * The components of the active arguments are numbered in the order of the
+   * tuple, the components of the first active argument coming first.
+   *
+   * \param[out] dx: seed
+   * \param[in] g: index of the component
+   */
+  template <typename ActiveArgumentsType>
+  constexpr void setActiveArgumentsSeed(ActiveArgumentsType& dx,
+                                        const std::size_t g) noexcept {
+    [&dx, g ]<std::size_t... i>(const std::index_sequence<i...>&) {
+      const auto set = [g](auto& s, const std::size_t o) {
+        using VariableType = std::decay_t<decltype(s)>;
+        if ((g >= o) && (g < o + getVariableSize<VariableType>())) {
+          setUnitSeed(s, g - o);
+        }
+      };
+      (set(std::get<i>(dx),
+           getActiveArgumentOffset<i, ActiveArgumentsType>()),
+       ...);
+    }
+    (std::make_index_sequence<std::tuple_size_v<ActiveArgumentsType>>{});
+  }  // end of setActiveArgumentsSeed
+
+}  // end of namespace tfel::math::enzyme::internals
+
+#endif /* LIB_TFEL_MATH_ENZYME_INTERNALS_ACTIVEARGUMENTS_HXX */
@@ -9,6 +9,7 @@
 #ifndef LIB_TFEL_MATH_ENZYME_INTERNALS_ENZYME_HXX
 #define LIB_TFEL_MATH_ENZYME_INTERNALS_ENZYME_HXX
 
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 #include "TFEL/Math/Enzyme/Internals/TypeList.hxx"
@@ -25,6 +26,20 @@ extern int enzyme_dup;
 extern int enzyme_out;
 //! \brief specifier used to introduce a standard variables
 extern int enzyme_const;
+/*!
+ * \brief specifier used to introduce the number of directions treated
+ * simultaneously by Enzyme's vector modes.
+ * \note see the enzyme documentation for details
+ */
+extern int enzyme_width;
+//! \brief specifier used to pass the tape to the reverse pass in split mode
+extern int enzyme_tape;
+/*!
+ * \brief specifier used to prevent the reverse pass from freeing the memory
+ * allocated by the augmented forward pass in split mode, so that the tape can
+ * be used several times
+ */
+extern int enzyme_nofree;
 
 /*!
  * \brief Enzyme'entry point for differentiation
@@ -44,8 +59,72 @@ ResultType __enzyme_autodiff(void*, ArgumentsTypes...);
 template <typename ResultType, typename... ArgumentsTypes>
 ResultType __enzyme_fwddiff(void*, ArgumentsTypes...);
 
+/*!
+ * \brief Enzyme'entry point for the augmented forward pass of the split
+ * reverse mode. This pass evaluates the callable and returns the tape.
+ * \tparam ResultType: type of the tape
+ * \tparam ArgumentsTypes: types of the arguments of the callable pointed by ptr
+ * \param[in] ptr:
+ */
+template <typename ResultType, typename... ArgumentsTypes>
+ResultType __enzyme_augmentfwd(void*, ArgumentsTypes...);
+
+/*!
+ * \brief Enzyme'entry point for the reverse pass of the split reverse mode.
+ * This pass uses the tape returned by the augmented forward pass.
+ * \tparam ResultType: type of the result
+ * \tparam ArgumentsTypes: types of the arguments of the callable pointed by ptr
+ * \param[in] ptr:
+ */
+template <typename ResultType, typename... ArgumentsTypes>
+ResultType __enzyme_reverse(void*, ArgumentsTypes...);
+
+/*!
+ * \brief maximum number of directions treated by one call to Enzyme in vector
+ * mode.
+ *
+ * Larger widths reduce the number of evaluations of the primal function but
+ * increase the size of the code generated by Enzyme.
+ */
+#ifndef TFEL_MATH_ENZYME_MAXIMUM_VECTOR_WIDTH
+#define TFEL_MATH_ENZYME_MAXIMUM_VECTOR_WIDTH 9
+#endif /* TFEL_MATH_ENZYME_MAXIMUM_VECTOR_WIDTH */
+
+/*!
+ * \brief number of points treated by one call to Enzyme in the batched
+ * functions, such as `computeDerivativeBatch`.
+ */
+#ifndef TFEL_MATH_ENZYME_BATCH_SIZE
+#define TFEL_MATH_ENZYME_BATCH_SIZE 4
+#endif /* TFEL_MATH_ENZYME_BATCH_SIZE */
+
+/*!
+ * \brief default number of snapshots used by the checkpointed reverse mode
+ * differentiation of loops, such as `checkpointed_loop_vjp`.
+ */
+#ifndef TFEL_MATH_ENZYME_NUMBER_OF_SNAPSHOTS
+#define TFEL_MATH_ENZYME_NUMBER_OF_SNAPSHOTS 16
+#endif /* TFEL_MATH_ENZYME_NUMBER_OF_SNAPSHOTS */
+
 namespace tfel::math::enzyme::internals {
 
+  //! \brief maximum number of directions treated by a vector mode call
+  inline constexpr std::size_t maximumVectorWidth =
+      TFEL_MATH_ENZYME_MAXIMUM_VECTOR_WIDTH;
+
+  static_assert(maximumVectorWidth > 0,
+                "invalid value for TFEL_MATH_ENZYME_MAXIMUM_VECTOR_WIDTH");
+
+  //! \brief number of points treated by a batched call
+  inline constexpr std::size_t batchSize = TFEL_MATH_ENZYME_BATCH_SIZE;
+
+  static_assert(batchSize > 0,
+                "invalid value for TFEL_MATH_ENZYME_BATCH_SIZE");
+
+  //! \brief default number of snapshots of a checkpointed loop
+  inline constexpr std::size_t defaultNumberOfSnapshots =
+      TFEL_MATH_ENZYME_NUMBER_OF_SNAPSHOTS;
+
   template <typename SourceType, typename DestinationType>
   struct IsConvertible : std::is_convertible<SourceType, DestinationType> {};
 
@@ -160,7 +239,39 @@ namespace tfel::math::enzyme::internals {
 
 namespace tfel::math::enzyme {
 
-  enum struct Mode { FORWARD, REVERSE };
+  //! \brief differentiation mode
+  enum struct Mode {
+    //! \brief forward mode, vectorized over the components of the variables
+    FORWARD,
+    //! \brief reverse mode, vectorized over the components of the result
+    REVERSE,
+    /*!
+     * \brief the mode is chosen at compile-time from the sizes of the
+     * variables and of the result of the callable.
+     * \see ModeSelectionPolicy
+     */
+    AUTO
+  };
+
+  /*!
+   * \brief treatment of the symmetry of a derivative of a math object with
+   * respect to a math object of the same size.
+   */
+  enum struct Symmetry {
+    //! \brief the derivative is returned as computed
+    NONE,
+    /*!
+     * \brief the derivative is symmetrized, i.e. its lower triangular part
+     * is replaced by its upper triangular part, so that the result is
+     * exactly symmetric. This is meant for derivatives which are symmetric
+     * in exact arithmetic, as the hessian of a scalar function or the
+     * tangent operator of an hyperelastic behaviour.
+     *
+     * \note this does not reduce the cost of the differentiation: all the
+     * columns of the derivative are computed.
+     */
+    SYMMETRIZE
+  };
 
 }  // end of namespace tfel::math::enzyme
 
@@ -8,6 +8,9 @@
 #ifndef LIB_TFEL_MATH_ENZYME_INTERNALS_FUNCTIONUTILITIES_HXX
 #define LIB_TFEL_MATH_ENZYME_INTERNALS_FUNCTIONUTILITIES_HXX
 
+#include <cstddef>
+#include <utility>
+#include <type_traits>
 #include "TFEL/Math/Enzyme/Internals/TypeList.hxx"
 
 namespace tfel::math::enzyme::internals {
@@ -101,6 +104,45 @@ namespace tfel::math::enzyme::internals {
                                   (!isFunctionPointer<CallableType>()) &&
                                   (hasCallOperator<CallableType>());
 
+  //! \return the first argument if `b` is true, the second one otherwise
+  template <bool b, typename Type0, typename Type1>
+  constexpr decltype(auto) selectArgument(const Type0& a0,
+                                          const Type1& a1) noexcept {
+    if constexpr (b) {
+      return (a0);
+    } else {
+      return (a1);
+    }
+  }  // end of selectArgument
+
+  /*!
+   * \brief return a callable of one variable obtained by fixing all the
+   * arguments of a callable but the one designated by `idx`.
+   *
+   * \tparam idx: index of the remaining variable
+   * \tparam VariableType: type of the remaining variable
+   * \param[in] c: callable
+   * \param[in] args: arguments of the callable. The argument at position
+   * `idx` is ignored.
+   *
+   * \note the callable and the arguments are captured by reference, so the
+   * returned object must not outlive them.
+   */
+  template <std::size_t idx,
+            typename VariableType,
+            typename CallableType,
+            typename... ArgumentsTypes>
+  auto bindAllArgumentsButOne(const CallableType& c,
+                              const ArgumentsTypes&... args)  //
+      requires(idx < sizeof...(ArgumentsTypes)) {
+    return [&c, &args...](const VariableType& x) {
+      return [&]<std::size_t... i>(const std::index_sequence<i...>&) {
+        return c(selectArgument<i == idx>(x, args)...);
+      }
+      (std::index_sequence_for<ArgumentsTypes...>{});
+    };
+  }  // end of bindAllArgumentsButOne
+
 }  // end of namespace tfel::math::enzyme::internals
 
 namespace tfel::math::enzyme {
@@ -0,0 +1,56 @@
+/*!
+ * \file   TFEL/Math/Enzyme/Kernels.hxx
+ * \brief  This file declares the derivative kernels compiled in the
+ * `TFELMathEnzymeKernels` library
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_KERNELS_HXX
+#define LIB_TFEL_MATH_ENZYME_KERNELS_HXX
+
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/Enzyme/DerivativeKernel.hxx"
+
+namespace tfel::math::enzyme::kernels {
+
+  //! \return the von Mises equivalent stress
+  template <unsigned short N>
+  double computeVonMisesStress(const stensor<N, double>& s) {
+    return sigmaeq(s);
+  }  // end of computeVonMisesStress
+
+  /*!
+   * \brief normal to the von Mises yield surface, i.e. the derivative of the
+   * von Mises equivalent stress
+   */
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+                                             computeVonMisesStress<1u>,
+                                             1);
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+                                             computeVonMisesStress<2u>,
+                                             1);
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+                                             computeVonMisesStress<3u>,
+                                             1);
+  //! \brief derivative of the normal to the von Mises yield surface
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormalDerivative,
+                                             computeVonMisesStress<1u>,
+                                             2);
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormalDerivative,
+                                             computeVonMisesStress<2u>,
+                                             2);
+  TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeVonMisesNormalDerivative,
+                                             computeVonMisesStress<3u>,
+                                             2);
+
+}  // end of namespace tfel::math::enzyme::kernels
+
+#endif /* LIB_TFEL_MATH_ENZYME_KERNELS_HXX */
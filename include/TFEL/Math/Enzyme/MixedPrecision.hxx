@@ -0,0 +1,254 @@
+/*!
+ * \file   TFEL/Math/Enzyme/MixedPrecision.hxx
+ * \brief  This file declares functions computing derivatives stored in a
+ * lower precision than the one used to evaluate the callable
+ * \author Thomas Helfer
+ * \date   14/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_MIXEDPRECISION_HXX
+#define LIB_TFEL_MATH_ENZYME_MIXEDPRECISION_HXX
+
+#include <span>
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Forward/qt.hxx"
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+#include "TFEL/Math/Enzyme/ModeSelection.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief a traits class returning the type obtained by replacing the base
+   * type of a scalar or a math object by `ValueType`, the units, if any,
+   * being preserved.
+   */
+  template <typename Type, typename ValueType>
+  struct RebindBaseType;
+
+  //! \brief partial specialisation for arithmetic types
+  template <typename Type, typename ValueType>
+  requires(std::is_arithmetic_v<Type>) struct RebindBaseType<Type, ValueType> {
+    using type = ValueType;
+  };
+
+  //! \brief partial specialisation for quantities
+  template <typename UnitType, typename Type, typename ValueType>
+  struct RebindBaseType<qt<UnitType, Type>, ValueType> {
+    using type = qt<UnitType, typename RebindBaseType<Type, ValueType>::type>;
+  };
+
+  //! \brief partial specialisation for math objects such as `stensor`,
+  //! `tensor`, `st2tost2` or `tvector`
+  template <template <unsigned short, typename> class MathObjectType,
+            unsigned short N,
+            typename Type,
+            typename ValueType>
+  struct RebindBaseType<MathObjectType<N, Type>, ValueType> {
+    using type =
+        MathObjectType<N, typename RebindBaseType<Type, ValueType>::type>;
+  };
+
+  //! \brief partial specialisation for math objects such as `tmatrix`
+  template <template <unsigned short, unsigned short, typename>
+            class MathObjectType,
+            unsigned short N,
+            unsigned short M,
+            typename Type,
+            typename ValueType>
+  struct RebindBaseType<MathObjectType<N, M, Type>, ValueType> {
+    using type =
+        MathObjectType<N, M, typename RebindBaseType<Type, ValueType>::type>;
+  };
+
+  /*!
+   * \brief traits class describing the types involved in the mixed
+   * precision differentiation of a callable of one variable.
+   */
+  template <typename CallableType,
+            typename ValueType,
+            typename ArgumentsList =
+                typename FunctionTraits<CallableType>::type>
+  struct MixedPrecisionBatchTraits;
+
+  //! \brief partial specialisation for callables of one variable
+  template <typename CallableType,
+            typename ValueType,
+            typename CallableArgumentType>
+  struct MixedPrecisionBatchTraits<CallableType,
+                                   ValueType,
+                                   TypeList<CallableArgumentType>> {
+    //! \brief type of the variable
+    using variable_type = std::decay_t<CallableArgumentType>;
+    //! \brief type of the result
+    using result_type =
+        std::invoke_result_t<CallableType, const variable_type&>;
+    //! \brief type of the derivative
+    using derivative_type = ::tfel::math::derivative_type<
+        typename RebindBaseType<result_type, ValueType>::type,
+        typename RebindBaseType<variable_type, ValueType>::type>;
+  };
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief type of the derivative of an object of type `ResultType` with
+   * respect to an object of type `VariableType`, whose base type is
+   * `ValueType`.
+   */
+  template <typename ResultType, typename VariableType, typename ValueType>
+  using mixed_precision_derivative_type = derivative_type<
+      typename internals::RebindBaseType<std::decay_t<ResultType>,
+                                         ValueType>::type,
+      typename internals::RebindBaseType<std::decay_t<VariableType>,
+                                         ValueType>::type>;
+
+  /*!
+   * \brief compute the derivative of a callable with respect to the
+   * variable designated by the index `idx`, the derivative being stored
+   * using the base type `ValueType`.
+   *
+   * The callable and its tangent are evaluated in the precision of its
+   * arguments, typically `double`, and each component of the derivative is
+   * rounded to `ValueType`, typically `float`, when it is stored. No
+   * derivative in the precision of the arguments is created.
+   *
+   * \tparam m: differentiation mode
+   * \tparam ValueType: base type of the derivative
+   * \tparam idx: index of the variable with respect to which the derivative
+   * is computed. This index can be omitted for callables of one variable.
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: types of the arguments passed to the callable
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   */
+  template <Mode m,
+            typename ValueType,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  auto computeMixedPrecisionDerivative(const CallableType&,
+                                       ArgumentsTypes&&...)  //
+      requires(std::is_floating_point_v<ValueType> &&
+               ((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>));
+
+  /*!
+   * \brief compute the derivative of a free function with respect to the
+   * variable designated by the index `idx`, the derivative being stored
+   * using the base type `ValueType`.
+   *
+   * \tparam m: differentiation mode
+   * \tparam ValueType: base type of the derivative
+   * \tparam idx: index of the variable with respect to which the derivative
+   * is computed
+   * \tparam F: pointer to the free function
+   * \tparam ArgumentsTypes: types of the arguments passed to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] args: arguments passed to the free function
+   */
+  template <Mode m,
+            typename ValueType,
+            std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto computeMixedPrecisionDerivative(internals::FunctionWrapper<F>,
+                                       ArgumentsTypes&&...)  //
+      requires(std::is_floating_point_v<ValueType> &&
+               ((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>));
+
+  /*!
+   * \brief return a function computing the derivative of a callable with
+   * respect to its `N`-th argument, the derivative being stored using the
+   * base type `ValueType`.
+   *
+   * \tparam m: differentiation mode
+   * \tparam ValueType: base type of the derivative
+   * \tparam N: index of the variable
+   * \param[in] c: callable
+   */
+  template <Mode m,
+            typename ValueType,
+            std::size_t N,
+            internals::EnzymeCallableConcept CallableType>
+  auto getMixedPrecisionDerivativeFunction(const CallableType&) requires(
+      std::is_floating_point_v<ValueType>);
+
+  /*!
+   * \brief return a function computing the derivative of a free function
+   * with respect to its `N`-th argument, the derivative being stored using
+   * the base type `ValueType`.
+   *
+   * \tparam m: differentiation mode
+   * \tparam ValueType: base type of the derivative
+   * \tparam N: index of the variable
+   * \tparam F: pointer to the free function
+   */
+  template <Mode m,
+            typename ValueType,
+            std::size_t N,
+            internals::IsFunctionPointerConcept auto F>
+  auto getMixedPrecisionDerivativeFunction(
+      internals::FunctionWrapper<F>) requires(
+      std::is_floating_point_v<ValueType>);
+
+  /*!
+   * \brief compute the derivatives of a callable of one variable at many
+   * points, the derivatives being stored using the base type `ValueType`.
+   *
+   * This function behaves as `computeDerivativeBatch`: the points are
+   * treated by blocks of `TFEL_MATH_ENZYME_BATCH_SIZE` points, each block
+   * being differentiated by a single call to Enzyme, but only the
+   * derivatives of a block are held in the precision of the variable.
+   *
+   * \tparam m: differentiation mode
+   * \tparam ValueType: base type of the derivatives
+   * \tparam CallableType: type of the callable
+   * \param[in] c: callable
+   * \param[in] in: values of the variable
+   * \param[out] out: derivatives
+   *
+   * \note an exception is thrown if the sizes of the input and output
+   * spans differ.
+   */
+  template <Mode m,
+            typename ValueType,
+            internals::EnzymeCallableConcept CallableType>
+  void computeMixedPrecisionDerivativeBatch(
+      const CallableType&,
+      std::span<const typename internals::
+                    MixedPrecisionBatchTraits<CallableType,
+                                              ValueType>::variable_type>,
+      std::span<typename internals::
+                    MixedPrecisionBatchTraits<CallableType,
+                                              ValueType>::derivative_type>)
+      requires(std::is_floating_point_v<ValueType>&&  //
+               VariableConcept<typename internals::MixedPrecisionBatchTraits<
+                   CallableType,
+                   ValueType>::result_type>);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/MixedPrecision.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_MIXEDPRECISION_HXX */
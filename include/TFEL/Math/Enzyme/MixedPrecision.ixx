@@ -0,0 +1,233 @@
+/*!
+ * \file   TFEL/Math/Enzyme/MixedPrecision.ixx
+ * \brief  This file implements the functions computing derivatives stored
+ * in a lower precision than the one used to evaluate the callable
+ * \author Thomas Helfer
+ * \date   14/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_MIXEDPRECISION_IXX
+#define LIB_TFEL_MATH_ENZYME_MIXEDPRECISION_IXX
+
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/computeDerivativeBatch.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief compute the derivative of a callable of one variable. The
+   * components computed by Enzyme are directly rounded to the base type of
+   * the derivative.
+   * \tparam m: differentiation mode
+   * \tparam DerivativeType: type of the derivative
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <Mode m,
+            typename DerivativeType,
+            EnzymeCallableConcept CallableType,
+            typename VariableType>
+  DerivativeType computeMixedPrecisionDerivativeImplementation(
+      const CallableType& c, const VariableType& x) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    if constexpr (ScalarConcept<VariableType>) {
+      // a single forward pass is required
+      const auto dv = ::tfel::math::enzyme::fwddiff(
+          c, make_vdv<VariableType>(x, VariableType{1}));
+      return convertShadow<DerivativeType>(dv);
+    } else {
+      auto v = ResultType{};
+      auto r = DerivativeType{};
+      if constexpr (resolveMode<m, ResultType, VariableType>() ==
+                    Mode::FORWARD) {
+        computeForwardModeDerivativeColumns<0, Symmetry::NONE>(
+            v, r, c, TypeList<const VariableType&>{}, x);
+      } else {
+        computeReverseModeDerivativeRows<0>(v, r, c, x);
+      }
+      return r;
+    }
+  }  // end of computeMixedPrecisionDerivativeImplementation
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeMixedPrecisionDerivativeImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>,
+      ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (idx < sizeof...(ArgumentsTypes))) {
+    using VariableType = std::decay_t<
+        std::tuple_element_t<idx, std::tuple<CallableArgumentsTypes...>>>;
+    using ResultType = std::invoke_result_t<CallableType, ArgumentsTypes...>;
+    using DerivativeType =
+        mixed_precision_derivative_type<ResultType, VariableType, ValueType>;
+    const auto x = static_cast<VariableType>(
+        std::get<idx>(std::forward_as_tuple(args...)));
+    // the other arguments are considered constant
+    const auto bc = bindAllArgumentsButOne<idx, VariableType>(c, args...);
+    return computeMixedPrecisionDerivativeImplementation<m, DerivativeType>(
+        bc, x);
+  }  // end of computeMixedPrecisionDerivativeImplementation
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t... idx,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeMixedPrecisionDerivativeImplementation(
+      FunctionWrapper<F>,
+      const TypeList<FunctionArgumentsTypes...>,
+      ArgumentsTypes&&... args)  //
+      requires(std::is_invocable_v<decltype(F), ArgumentsTypes...>) {
+    auto c = [](const FunctionArgumentsTypes... wargs) { return F(wargs...); };
+    return ::tfel::math::enzyme::computeMixedPrecisionDerivative<m, ValueType,
+                                                                 idx...>(
+        c, std::forward<ArgumentsTypes>(args)...);
+  }  // end of computeMixedPrecisionDerivativeImplementation
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t N,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes>
+  auto getMixedPrecisionDerivativeFunctionImplementation(
+      const CallableType& c, const TypeList<CallableArgumentsTypes...>)  //
+      requires(N < sizeof...(CallableArgumentsTypes)) {
+    return [c](CallableArgumentsTypes... wargs) {
+      return ::tfel::math::enzyme::computeMixedPrecisionDerivative<
+          m, ValueType, N>(c, wargs...);
+    };
+  }  // end of getMixedPrecisionDerivativeFunctionImplementation
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t N,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes>
+  auto getMixedPrecisionDerivativeFunctionImplementation(
+      FunctionWrapper<F> f, const TypeList<FunctionArgumentsTypes...>)  //
+      requires(N < sizeof...(FunctionArgumentsTypes)) {
+    return [f](FunctionArgumentsTypes... wargs) {
+      return ::tfel::math::enzyme::computeMixedPrecisionDerivative<
+          m, ValueType, N>(f, wargs...);
+    };
+  }  // end of getMixedPrecisionDerivativeFunctionImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  auto computeMixedPrecisionDerivative(const CallableType& c,
+                                       ArgumentsTypes&&... args)  //
+      requires(std::is_floating_point_v<ValueType> &&
+               ((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      return internals::computeMixedPrecisionDerivativeImplementation<
+          m, ValueType, 0>(c, internals::getArgumentsList<CallableType>(),
+                           std::forward<ArgumentsTypes>(args)...);
+    } else {
+      return internals::computeMixedPrecisionDerivativeImplementation<
+          m, ValueType, idx...>(c, internals::getArgumentsList<CallableType>(),
+                                std::forward<ArgumentsTypes>(args)...);
+    }
+  }  // end of computeMixedPrecisionDerivative
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto computeMixedPrecisionDerivative(internals::FunctionWrapper<F> f,
+                                       ArgumentsTypes&&... args)  //
+      requires(std::is_floating_point_v<ValueType> &&
+               ((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>)) {
+    return internals::computeMixedPrecisionDerivativeImplementation<
+        m, ValueType, idx...>(f, internals::getArgumentsList<decltype(F)>(),
+                              std::forward<ArgumentsTypes>(args)...);
+  }  // end of computeMixedPrecisionDerivative
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t N,
+            internals::EnzymeCallableConcept CallableType>
+  auto getMixedPrecisionDerivativeFunction(const CallableType& c) requires(
+      std::is_floating_point_v<ValueType>) {
+    return internals::getMixedPrecisionDerivativeFunctionImplementation<
+        m, ValueType, N>(c, internals::getArgumentsList<CallableType>());
+  }  // end of getMixedPrecisionDerivativeFunction
+
+  template <Mode m,
+            typename ValueType,
+            std::size_t N,
+            internals::IsFunctionPointerConcept auto F>
+  auto getMixedPrecisionDerivativeFunction(
+      internals::FunctionWrapper<F> f) requires(
+      std::is_floating_point_v<ValueType>) {
+    return internals::getMixedPrecisionDerivativeFunctionImplementation<
+        m, ValueType, N>(f, internals::getArgumentsList<decltype(F)>());
+  }  // end of getMixedPrecisionDerivativeFunction
+
+  template <Mode m,
+            typename ValueType,
+            internals::EnzymeCallableConcept CallableType>
+  void computeMixedPrecisionDerivativeBatch(
+      const CallableType& c,
+      std::span<const typename internals::
+                    MixedPrecisionBatchTraits<CallableType,
+                                              ValueType>::variable_type> in,
+      std::span<typename internals::
+                    MixedPrecisionBatchTraits<CallableType,
+                                              ValueType>::derivative_type> out)
+      requires(std::is_floating_point_v<ValueType>&&  //
+               VariableConcept<typename internals::MixedPrecisionBatchTraits<
+                   CallableType,
+                   ValueType>::result_type>) {
+    using Traits = internals::MixedPrecisionBatchTraits<CallableType, ValueType>;
+    using VariableType = typename Traits::variable_type;
+    using DerivativeType = typename Traits::derivative_type;
+    constexpr auto B = internals::batchSize;
+    tfel::raise_if<std::invalid_argument>(
+        in.size() != out.size(),
+        "computeMixedPrecisionDerivativeBatch: the number of inputs does not "
+        "match the number of outputs");
+    const auto bc = internals::makeBatchedCallable<B, VariableType>(c);
+    internals::computeDerivativeBatchRange<m, B, DerivativeType>(out, bc, in);
+  }  // end of computeMixedPrecisionDerivativeBatch
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_MIXEDPRECISION_IXX */
@@ -0,0 +1,112 @@
+/*!
+ * \file   TFEL/Math/Enzyme/ModeSelection.hxx
+ * \brief  This file declares the heuristics used to select the
+ * differentiation mode when `Mode::AUTO` is requested
+ * \author Thomas Helfer
+ * \date   09/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_MODESELECTION_HXX
+#define LIB_TFEL_MATH_ENZYME_MODESELECTION_HXX
+
+#include <cstddef>
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief heuristics used to select the differentiation mode of a callable
+   * returning an object of type `ResultType` with respect to variables of
+   * types `VariablesTypes` when `Mode::AUTO` is requested.
+   *
+   * The cost of the forward mode is proportional to the number of
+   * components of the variables, while the cost of the reverse mode is
+   * proportional to the number of components of the result. Hence, the
+   * reverse mode is selected for scalar results and the forward mode is
+   * selected if the number of components of the variables does not exceed
+   * the number of components of the result. Both modes are vectorized, so
+   * the forward mode is in fact a vector forward mode.
+   *
+   * The reverse mode only handles the derivatives of non scalar results
+   * with respect to one variable, so the forward mode is always selected in
+   * the other cases.
+   *
+   * This class may be specialised to override those heuristics.
+   */
+  template <typename ResultType, typename... VariablesTypes>
+  struct ModeSelectionPolicy {
+    //! \brief number of components of the variables
+    static constexpr std::size_t input_size =
+        (internals::getVariableSize<VariablesTypes>() + ...);
+    //! \brief number of components of the result
+    static constexpr std::size_t output_size =
+        internals::getVariableSize<ResultType>();
+    //! \brief selected mode
+    static constexpr Mode mode = [] {
+      if constexpr (ScalarConcept<ResultType>) {
+        return Mode::REVERSE;
+      } else if constexpr (sizeof...(VariablesTypes) > 1) {
+        return Mode::FORWARD;
+      } else {
+        return input_size <= output_size ? Mode::FORWARD : Mode::REVERSE;
+      }
+    }();
+  };
+
+  /*!
+   * \return the mode selected by `Mode::AUTO` to differentiate a callable
+   * with respect to the variables designated by the indices `idx`, or with
+   * respect to all its variables if no index is given.
+   * \tparam CallableType: type of the callable
+   * \tparam idx: indices of the variables
+   */
+  template <internals::EnzymeCallableConcept CallableType, std::size_t... idx>
+  constexpr Mode getAutomaticMode() noexcept;
+  /*!
+   * \return the mode selected by `Mode::AUTO` to differentiate a callable
+   * with respect to the variables designated by the indices `idx`, or with
+   * respect to all its variables if no index is given.
+   * \param[in] c: callable
+   */
+  template <std::size_t... idx, internals::EnzymeCallableConcept CallableType>
+  constexpr Mode getAutomaticMode(const CallableType&) noexcept;
+  /*!
+   * \return the mode selected by `Mode::AUTO` to differentiate a free
+   * function with respect to the variables designated by the indices `idx`,
+   * or with respect to all its variables if no index is given.
+   * \param[in] f: free function wrapper
+   */
+  template <std::size_t... idx, internals::IsFunctionPointerConcept auto F>
+  constexpr Mode getAutomaticMode(internals::FunctionWrapper<F>) noexcept;
+
+}  // end of namespace tfel::math::enzyme
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \return the given mode if it is not `Mode::AUTO`, the mode selected by
+   * the `ModeSelectionPolicy` class otherwise.
+   */
+  template <Mode m, typename ResultType, typename... VariablesTypes>
+  constexpr Mode resolveMode() noexcept {
+    if constexpr (m == Mode::AUTO) {
+      return ModeSelectionPolicy<std::decay_t<ResultType>,
+                                 std::decay_t<VariablesTypes>...>::mode;
+    } else {
+      return m;
+    }
+  }  // end of resolveMode
+
+}  // end of namespace tfel::math::enzyme::internals
+
+#include "TFEL/Math/Enzyme/ModeSelection.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_MODESELECTION_HXX */
@@ -0,0 +1,69 @@
+/*!
+ * \file   TFEL/Math/Enzyme/ModeSelection.ixx
+ * \brief  This file implements the getAutomaticMode functions
+ * \author Thomas Helfer
+ * \date   09/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_MODESELECTION_IXX
+#define LIB_TFEL_MATH_ENZYME_MODESELECTION_IXX
+
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+namespace tfel::math::enzyme::internals {
+
+  template <typename CallableType,
+            std::size_t... idx,
+            typename... CallableArgumentsTypes>
+  constexpr Mode getAutomaticModeImplementation(
+      const TypeList<CallableArgumentsTypes...>&) noexcept {
+    using ResultType =
+        std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    using ArgumentsTypes = std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    if constexpr (sizeof...(idx) == 0) {
+      return resolveMode<Mode::AUTO, ResultType,
+                         std::decay_t<CallableArgumentsTypes>...>();
+    } else {
+      static_assert(((idx < sizeof...(CallableArgumentsTypes)) && ...),
+                    "invalid index");
+      return resolveMode<Mode::AUTO, ResultType,
+                         std::tuple_element_t<idx, ArgumentsTypes>...>();
+    }
+  }  // end of getAutomaticModeImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType, std::size_t... idx>
+  constexpr Mode getAutomaticMode() noexcept {
+    using ArgumentsList =
+        typename internals::FunctionTraits<CallableType>::type;
+    return internals::getAutomaticModeImplementation<CallableType, idx...>(
+        ArgumentsList{});
+  }  // end of getAutomaticMode
+
+  template <std::size_t... idx, internals::EnzymeCallableConcept CallableType>
+  constexpr Mode getAutomaticMode(const CallableType&) noexcept {
+    return getAutomaticMode<CallableType, idx...>();
+  }  // end of getAutomaticMode
+
+  template <std::size_t... idx, internals::IsFunctionPointerConcept auto F>
+  constexpr Mode getAutomaticMode(internals::FunctionWrapper<F>) noexcept {
+    using ArgumentsList =
+        typename internals::FunctionTraits<decltype(F)>::type;
+    return internals::getAutomaticModeImplementation<decltype(F), idx...>(
+        ArgumentsList{});
+  }  // end of getAutomaticMode
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_MODESELECTION_IXX */
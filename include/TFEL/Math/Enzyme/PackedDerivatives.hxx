@@ -0,0 +1,78 @@
+/*!
+ * \file   TFEL/Math/Enzyme/PackedDerivatives.hxx
+ * \brief  This header introduces the PackedDerivatives class used to return
+ * the derivatives of a callable with respect to several of its arguments
+ * \author Thomas Helfer
+ * \date   19/08/2024
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_PACKEDDERIVATIVES_HXX
+#define LIB_TFEL_MATH_ENZYME_PACKEDDERIVATIVES_HXX
+
+#include <tuple>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace tfel::math::enzyme::internals {
+
+  template <std::size_t N, typename DerivativeType>
+  struct DerivativeHolder {
+    DerivativeType value;
+  };
+
+  template <std::size_t N,
+            typename CurrentDerivativeType,
+            typename... DerivativesTypes>
+  struct PackedDerivativesImplementation
+      : DerivativeHolder<N, CurrentDerivativeType>,
+        PackedDerivativesImplementation<N + 1, DerivativesTypes...> {};
+
+  template <std::size_t N, typename DerivativeType>
+  struct PackedDerivativesImplementation<N, DerivativeType>
+      : DerivativeHolder<N, DerivativeType> {};
+
+}  // namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <typename... DerivativesTypes>
+  struct PackedDerivatives
+      : internals::PackedDerivativesImplementation<0, DerivativesTypes...> {};
+
+  template <std::size_t N, typename... DerivativesTypes>
+  auto& get(PackedDerivatives<DerivativesTypes...>& derivatives) noexcept  //
+      requires(N < sizeof...(DerivativesTypes)) {
+    using DerivativeType =
+        std::tuple_element_t<N, std::tuple<DerivativesTypes...>>;
+    return static_cast<internals::DerivativeHolder<N, DerivativeType>&>(derivatives)
+        .value;
+  }  // end of get
+
+  template <std::size_t N, typename... DerivativesTypes>
+  const auto& get(
+      const PackedDerivatives<DerivativesTypes...>& derivatives) noexcept  //
+      requires(N < sizeof...(DerivativesTypes)) {
+    using DerivativeType =
+        std::tuple_element_t<N, std::tuple<DerivativesTypes...>>;
+    return static_cast<const internals::DerivativeHolder<N, DerivativeType>&>(
+               derivatives)
+        .value;
+  }  // end of get
+
+}  // end of namespace tfel::math::enzyme
+
+namespace std {
+
+  template <typename... DerivativesTypes>
+  struct tuple_size<::tfel::math::enzyme::PackedDerivatives<DerivativesTypes...>>
+      : integral_constant<size_t, sizeof...(DerivativesTypes)> {};
+
+  template <std::size_t N, typename... DerivativesTypes>
+  struct tuple_element<N,
+                       ::tfel::math::enzyme::PackedDerivatives<DerivativesTypes...>>
+      : tuple_element<N, std::tuple<DerivativesTypes...>> {};
+
+}  // namespace std
+
+#endif /* LIB_TFEL_MATH_ENZYME_PACKEDDERIVATIVES_HXX */
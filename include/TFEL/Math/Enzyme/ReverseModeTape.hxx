@@ -0,0 +1,109 @@
+/*!
+ * \file   TFEL/Math/Enzyme/ReverseModeTape.hxx
+ * \brief  This file declares the ReverseModeTape class
+ * \author Thomas Helfer
+ * \date   04/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_REVERSEMODETAPE_HXX
+#define LIB_TFEL_MATH_ENZYME_REVERSEMODETAPE_HXX
+
+#include <type_traits>
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief a class evaluating a callable of one variable once using the
+   * augmented forward pass of Enzyme's split reverse mode and storing the
+   * tape, so that any number of vector-Jacobian products can be computed
+   * afterwards without evaluating the callable again.
+   *
+   * \tparam CallableType: type of the callable
+   * \tparam VariableType: type of the variable
+   *
+   * \note the callable must outlive the tape.
+   * \note the memory associated with the tape is released by the destructor
+   * using a last reverse pass.
+   */
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      struct ReverseModeTape {
+    //! \brief type of the result of the callable
+    using result_type =
+        std::invoke_result_t<CallableType, const VariableType&>;
+    /*!
+     * \brief type of the adjoint of the variable.
+     *
+     * \note the adjoint is stored in an object of the same type than the
+     * variable, as done by Enzyme.
+     */
+    using adjoint_type = VariableType;
+    //! \brief type of the derivative of the callable
+    using derivative_type =
+        ::tfel::math::derivative_type<result_type, VariableType>;
+    /*!
+     * \brief constructor
+     * \param[in] c: callable
+     * \param[in] x: value of the variable
+     */
+    ReverseModeTape(const CallableType&, const VariableType&);
+    //! \brief move constructor
+    ReverseModeTape(ReverseModeTape&&) noexcept;
+    ReverseModeTape(const ReverseModeTape&) = delete;
+    ReverseModeTape& operator=(ReverseModeTape&&) = delete;
+    ReverseModeTape& operator=(const ReverseModeTape&) = delete;
+    //! \return the value of the callable
+    const result_type& getValue() const noexcept;
+    /*!
+     * \return the product of the given adjoint of the result of the callable
+     * by the derivative of the callable, i.e. the adjoint of the variable.
+     * \param[in] dr: adjoint of the result of the callable
+     */
+    adjoint_type computeVectorJacobianProduct(const result_type&) const;
+    /*!
+     * \return the derivative of the callable. One reverse pass is performed
+     * per component of the result of the callable.
+     */
+    derivative_type computeDerivative() const;
+    //! \brief destructor
+    ~ReverseModeTape();
+
+   private:
+    //! \brief function differentiated by Enzyme
+    static void evaluate(const CallableType* const,
+                         const VariableType* const,
+                         result_type* const);
+    //! \brief callable
+    const CallableType* const callable;
+    //! \brief value of the variable
+    const VariableType variable;
+    //! \brief value of the callable
+    result_type value;
+    //! \brief tape returned by the augmented forward pass
+    void* tape;
+  };
+
+  //! \brief deduction guide
+  template <internals::EnzymeCallableConcept CallableType,
+            typename VariableType>
+  ReverseModeTape(const CallableType&, const VariableType&)
+      -> ReverseModeTape<CallableType, VariableType>;
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/ReverseModeTape.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_REVERSEMODETAPE_HXX */
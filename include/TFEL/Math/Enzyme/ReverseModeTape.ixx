@@ -0,0 +1,142 @@
+/*!
+ * \file   TFEL/Math/Enzyme/ReverseModeTape.ixx
+ * \brief  This file implements the ReverseModeTape class
+ * \author Thomas Helfer
+ * \date   04/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_REVERSEMODETAPE_IXX
+#define LIB_TFEL_MATH_ENZYME_REVERSEMODETAPE_IXX
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      void ReverseModeTape<CallableType, VariableType>::evaluate(
+          const CallableType* const c,
+          const VariableType* const x,
+          result_type* const r) {
+    *r = (*c)(*x);
+  }  // end of evaluate
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      ReverseModeTape<CallableType, VariableType>::ReverseModeTape(
+          const CallableType& c, const VariableType& x)
+      : callable(&c), variable(x), value{}, tape(nullptr) {
+    void* const evaluate_ptr = reinterpret_cast<void*>(&evaluate);
+    const void* const c_ptr = reinterpret_cast<const void*>(this->callable);
+    auto dx = adjoint_type{};
+    auto dr = result_type{};
+    this->tape = __enzyme_augmentfwd<void*>(
+        evaluate_ptr,                        //
+        enzyme_const, c_ptr,                 //
+        enzyme_dup, &(this->variable), &dx,  //
+        enzyme_dup, &(this->value), &dr);
+  }  // end of ReverseModeTape
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      ReverseModeTape<CallableType, VariableType>::ReverseModeTape(
+          ReverseModeTape&& src) noexcept
+      : callable(src.callable),
+        variable(src.variable),
+        value(src.value),
+        tape(src.tape) {
+    src.tape = nullptr;
+  }  // end of ReverseModeTape
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      const typename ReverseModeTape<CallableType, VariableType>::result_type&
+      ReverseModeTape<CallableType, VariableType>::getValue() const noexcept {
+    return this->value;
+  }  // end of getValue
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      typename ReverseModeTape<CallableType, VariableType>::adjoint_type
+      ReverseModeTape<CallableType, VariableType>::computeVectorJacobianProduct(
+          const result_type& seed) const {
+    void* const evaluate_ptr = reinterpret_cast<void*>(&evaluate);
+    const void* const c_ptr = reinterpret_cast<const void*>(this->callable);
+    auto dx = adjoint_type{};
+    // the seed is reset to zero by the reverse pass
+    auto dr = seed;
+    // the memory of the tape must not be freed so that it can be reused
+    __enzyme_reverse<void>(evaluate_ptr, enzyme_nofree,         //
+                           enzyme_const, c_ptr,                 //
+                           enzyme_dup, &(this->variable), &dx,  //
+                           enzyme_dup, &(this->value), &dr,     //
+                           enzyme_tape, this->tape);
+    return dx;
+  }  // end of computeVectorJacobianProduct
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      typename ReverseModeTape<CallableType, VariableType>::derivative_type
+      ReverseModeTape<CallableType, VariableType>::computeDerivative() const {
+    auto r = derivative_type{};
+    if constexpr (ScalarConcept<result_type>) {
+      const auto dx = this->computeVectorJacobianProduct(result_type{1});
+      r = internals::convertShadow<derivative_type>(dx);
+    } else {
+      constexpr auto n = internals::getVariableSize<result_type>();
+      for (std::size_t i = 0; i != n; ++i) {
+        auto seed = result_type{};
+        internals::setUnitSeed(seed, i);
+        internals::setDerivativeRow(r, i,
+                                    this->computeVectorJacobianProduct(seed));
+      }
+    }
+    return r;
+  }  // end of computeDerivative
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept VariableType>
+  requires((std::is_invocable_v<CallableType, const VariableType&>)&&  //
+           (VariableConcept<
+               std::invoke_result_t<CallableType, const VariableType&>>))  //
+      ReverseModeTape<CallableType, VariableType>::~ReverseModeTape() {
+    if (this->tape == nullptr) {
+      return;
+    }
+    // a last reverse pass with null seeds releases the memory of the tape
+    void* const evaluate_ptr = reinterpret_cast<void*>(&evaluate);
+    const void* const c_ptr = reinterpret_cast<const void*>(this->callable);
+    auto dx = adjoint_type{};
+    auto dr = result_type{};
+    __enzyme_reverse<void>(evaluate_ptr,                        //
+                           enzyme_const, c_ptr,                 //
+                           enzyme_dup, &(this->variable), &dx,  //
+                           enzyme_dup, &(this->value), &dr,     //
+                           enzyme_tape, this->tape);
+  }  // end of ~ReverseModeTape
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_REVERSEMODETAPE_IXX */
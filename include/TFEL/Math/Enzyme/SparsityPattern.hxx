@@ -0,0 +1,94 @@
+/*!
+ * \file   TFEL/Math/Enzyme/SparsityPattern.hxx
+ * \brief  This file declares the SparsityPattern class and the compile-time
+ * coloring of its columns
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_SPARSITYPATTERN_HXX
+#define LIB_TFEL_MATH_ENZYME_SPARSITYPATTERN_HXX
+
+#include <array>
+#include <cstddef>
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief structural non zero entries of a jacobian.
+   *
+   * This class is a structural type, so that sparsity patterns can be used
+   * as template arguments.
+   *
+   * \tparam NumberOfRows: number of rows, i.e. number of components of the
+   * result
+   * \tparam NumberOfColumns: number of columns, i.e. number of components of
+   * the variable
+   */
+  template <std::size_t NumberOfRows, std::size_t NumberOfColumns>
+  struct SparsityPattern {
+    //! \brief number of rows
+    static constexpr std::size_t number_of_rows = NumberOfRows;
+    //! \brief number of columns
+    static constexpr std::size_t number_of_columns = NumberOfColumns;
+    //! \return true if the given entry may be non zero
+    constexpr bool operator()(const std::size_t i,
+                              const std::size_t j) const noexcept {
+      return this->nonzeros[i][j];
+    }
+    //! \brief declare the given entry as non zero
+    constexpr SparsityPattern& set(const std::size_t i,
+                                   const std::size_t j) noexcept {
+      this->nonzeros[i][j] = true;
+      return *this;
+    }
+    //! \brief non zero entries
+    std::array<std::array<bool, NumberOfColumns>, NumberOfRows> nonzeros = {};
+  };
+
+  //! \return the sparsity pattern of a diagonal jacobian
+  template <std::size_t N>
+  constexpr SparsityPattern<N, N> makeDiagonalSparsityPattern() noexcept;
+  /*!
+   * \return the sparsity pattern of a banded jacobian
+   * \tparam N: number of rows and columns
+   * \tparam L: number of sub-diagonals
+   * \tparam U: number of super-diagonals
+   */
+  template <std::size_t N, std::size_t L, std::size_t U>
+  constexpr SparsityPattern<N, N> makeBandedSparsityPattern() noexcept;
+
+  /*!
+   * \brief a partition of the columns of a jacobian in groups (colors) of
+   * structurally orthogonal columns, i.e. columns having no non zero entry
+   * in the same row.
+   */
+  template <std::size_t NumberOfColumns>
+  struct ColumnColoring {
+    //! \brief color of each column
+    std::array<std::size_t, NumberOfColumns> colors = {};
+    //! \brief number of colors
+    std::size_t number_of_colors = 0;
+  };
+
+  /*!
+   * \return a coloring of the columns of a sparsity pattern.
+   *
+   * Each column is given the smallest color not already used by a column
+   * sharing a non zero row (greedy coloring in the natural order).
+   */
+  template <std::size_t NumberOfRows, std::size_t NumberOfColumns>
+  constexpr ColumnColoring<NumberOfColumns> computeColumnColoring(
+      const SparsityPattern<NumberOfRows, NumberOfColumns>&) noexcept;
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/SparsityPattern.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_SPARSITYPATTERN_HXX */
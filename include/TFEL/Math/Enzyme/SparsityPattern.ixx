@@ -0,0 +1,73 @@
+/*!
+ * \file   TFEL/Math/Enzyme/SparsityPattern.ixx
+ * \brief  This file implements the compile-time coloring of sparsity
+ * patterns
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_SPARSITYPATTERN_IXX
+#define LIB_TFEL_MATH_ENZYME_SPARSITYPATTERN_IXX
+
+namespace tfel::math::enzyme {
+
+  template <std::size_t N>
+  constexpr SparsityPattern<N, N> makeDiagonalSparsityPattern() noexcept {
+    return makeBandedSparsityPattern<N, 0, 0>();
+  }  // end of makeDiagonalSparsityPattern
+
+  template <std::size_t N, std::size_t L, std::size_t U>
+  constexpr SparsityPattern<N, N> makeBandedSparsityPattern() noexcept {
+    auto p = SparsityPattern<N, N>{};
+    for (std::size_t i = 0; i != N; ++i) {
+      const auto jmin = i > L ? i - L : std::size_t{0};
+      const auto jmax = i + U < N ? i + U + 1 : N;
+      for (auto j = jmin; j != jmax; ++j) {
+        p.set(i, j);
+      }
+    }
+    return p;
+  }  // end of makeBandedSparsityPattern
+
+  template <std::size_t NumberOfRows, std::size_t NumberOfColumns>
+  constexpr ColumnColoring<NumberOfColumns> computeColumnColoring(
+      const SparsityPattern<NumberOfRows, NumberOfColumns>& p) noexcept {
+    auto c = ColumnColoring<NumberOfColumns>{};
+    // colors already used in each row
+    auto used = std::array<std::array<bool, NumberOfColumns>, NumberOfRows>{};
+    for (std::size_t j = 0; j != NumberOfColumns; ++j) {
+      auto color = std::size_t{0};
+      for (; color != NumberOfColumns; ++color) {
+        auto available = true;
+        for (std::size_t i = 0; i != NumberOfRows; ++i) {
+          if (p(i, j) && used[i][color]) {
+            available = false;
+            break;
+          }
+        }
+        if (available) {
+          break;
+        }
+      }
+      c.colors[j] = color;
+      for (std::size_t i = 0; i != NumberOfRows; ++i) {
+        if (p(i, j)) {
+          used[i][color] = true;
+        }
+      }
+      if (color + 1 > c.number_of_colors) {
+        c.number_of_colors = color + 1;
+      }
+    }
+    return c;
+  }  // end of computeColumnColoring
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_SPARSITYPATTERN_IXX */
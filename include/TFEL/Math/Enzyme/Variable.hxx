@@ -69,6 +69,112 @@ namespace tfel::math::enzyme::internals {
   struct IsConvertible<VariableValueAndIncrement<SourceType>, DestinationType>
       : std::is_convertible<SourceType, DestinationType> {};
 
+  //! \return the number of components of a variable
+  template <VariableConcept VariableType>
+  constexpr std::size_t getVariableSize() noexcept {
+    if constexpr (ScalarConcept<VariableType>) {
+      return 1;
+    } else {
+      return static_cast<std::size_t>(VariableType{}.size());
+    }
+  }  // end of getVariableSize
+
+  /*!
+   * \return the `i`-th component of the storage of a math object, whatever
+   * its arity. Math objects of `TFEL/Math` store their components
+   * contiguously in row-major order.
+   */
+  template <MathObjectConcept MathObjectType>
+  constexpr auto& getFlatComponent(MathObjectType& v,
+                                   const std::size_t i) noexcept {
+    return *(v.begin() + i);
+  }  // end of getFlatComponent
+
+  //! \return the `i`-th component of the storage of a math object
+  template <MathObjectConcept MathObjectType>
+  constexpr const auto& getFlatComponent(const MathObjectType& v,
+                                         const std::size_t i) noexcept {
+    return *(v.begin() + i);
+  }  // end of getFlatComponent
+
+  //! \brief set the `i`-th component of a seed to one
+  template <VariableConcept VariableType>
+  constexpr void setUnitSeed(VariableType& v, const std::size_t i) noexcept {
+    if constexpr (ScalarConcept<VariableType>) {
+      static_cast<void>(i);
+      v = VariableType{1};
+    } else {
+      getFlatComponent(v, i) = numeric_type<VariableType>{1};
+    }
+  }  // end of setUnitSeed
+
+  /*!
+   * \brief convert a component of a shadow variable to a component of a
+   * derivative.
+   *
+   * Shadow variables used by Enzyme have the type of the primal variables,
+   * so their units (if any) differ from the ones of the derivatives. Only
+   * the numerical value is kept. This value is rounded if the base type of
+   * the destination is less precise than the one of the source, as in the
+   * mixed precision functions.
+   */
+  template <ScalarConcept DestinationType, ScalarConcept SourceType>
+  constexpr DestinationType convertShadowValue(const SourceType& v) noexcept {
+    using value_type = base_type<DestinationType>;
+    if constexpr (std::is_same_v<DestinationType, SourceType>) {
+      return v;
+    } else if constexpr (std::is_arithmetic_v<SourceType>) {
+      return DestinationType{static_cast<value_type>(v)};
+    } else {
+      return DestinationType{static_cast<value_type>(v.getValue())};
+    }
+  }  // end of convertShadowValue
+
+  /*!
+   * \brief convert a shadow variable to a derivative having the same layout,
+   * i.e. the derivative of a scalar with respect to the variable or the
+   * derivative of the variable with respect to a scalar.
+   */
+  template <VariableConcept DerivativeType, VariableConcept ShadowType>
+  constexpr DerivativeType convertShadow(const ShadowType& s) noexcept {
+    using value_type = numeric_type<DerivativeType>;
+    if constexpr (ScalarConcept<ShadowType>) {
+      return convertShadowValue<value_type>(s);
+    } else {
+      auto r = DerivativeType{};
+      for (std::size_t i = 0; i != getVariableSize<ShadowType>(); ++i) {
+        getFlatComponent(r, i) =
+            convertShadowValue<value_type>(getFlatComponent(s, i));
+      }
+      return r;
+    }
+  }  // end of convertShadow
+
+  /*!
+   * \brief copy a shadow of the variable, i.e. the gradient of the `i`-th
+   * component of the result of a callable, in the `i`-th row of a
+   * derivative.
+   *
+   * The rows of a derivative are indexed by the flat index of the
+   * components of the result and its columns by the flat index of the
+   * components of the variable, whatever their arities.
+   */
+  template <MathObjectConcept DerivativeType, VariableConcept ShadowType>
+  constexpr void setDerivativeRow(DerivativeType& r,
+                                  const std::size_t i,
+                                  const ShadowType& s) noexcept {
+    using value_type = numeric_type<DerivativeType>;
+    if constexpr (ScalarConcept<ShadowType>) {
+      getFlatComponent(r, i) = convertShadowValue<value_type>(s);
+    } else {
+      constexpr auto m = getVariableSize<ShadowType>();
+      for (std::size_t j = 0; j != m; ++j) {
+        getFlatComponent(r, i * m + j) =
+            convertShadowValue<value_type>(getFlatComponent(s, j));
+      }
+    }
+  }  // end of setDerivativeRow
+
 }  // end of namespace tfel::math::enzyme::internals
 
 #include "TFEL/Math/Enzyme/Variable.ixx"
@@ -0,0 +1,107 @@
+/*!
+ * \file   TFEL/Math/Enzyme/checkpointed_loop.hxx
+ * \brief  This file declares the checkpointed_loop function and the
+ * associated functions used to differentiate long loops in reverse mode
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_CHECKPOINTED_LOOP_HXX
+#define LIB_TFEL_MATH_ENZYME_CHECKPOINTED_LOOP_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief a concept describing a step of a loop, i.e. a callable computing
+   * the state at the end of the step from the state at the beginning of the
+   * step and, optionally, the index of the step.
+   */
+  template <typename StepType, typename StateType>
+  concept LoopStepConcept =
+      (VariableConcept<StateType>)&&(
+          (std::is_invocable_r_v<StateType, StepType, const StateType&>) ||
+          (std::is_invocable_r_v<StateType,
+                                 StepType,
+                                 const StateType&,
+                                 std::size_t>));
+
+  /*!
+   * \brief compute the state at the end of a loop of `n` steps
+   * \param[in] n: number of steps
+   * \param[in] step: step of the loop
+   * \param[in] s0: initial state
+   */
+  template <typename StepType, VariableConcept StateType>
+  StateType checkpointed_loop(const std::size_t,
+                              const StepType&,
+                              const StateType&)  //
+      requires(LoopStepConcept<StepType, StateType>);
+  /*!
+   * \brief compute the product of a cotangent of the final state of a loop
+   * by the derivative of the final state with respect to the initial state.
+   *
+   * Each step is differentiated separately by a single reverse pass, so
+   * that Enzyme only stores the intermediate values of one step. The states
+   * at the beginning of the steps are recomputed from at most
+   * `number_of_snapshots` stored states using a binomial checkpointing
+   * schedule (Griewank's revolve algorithm). The number of evaluations of
+   * the steps grows logarithmically with `n` for a fixed number of snapshots
+   * and memory can thus be traded for recomputation.
+   *
+   * \param[in] n: number of steps
+   * \param[in] step: step of the loop
+   * \param[in] s0: initial state
+   * \param[in] w: cotangent of the final state
+   * \param[in] number_of_snapshots: maximum number of stored states, in
+   * addition to the initial state
+   * \return the cotangent of the initial state
+   */
+  template <typename StepType, VariableConcept StateType>
+  StateType checkpointed_loop_vjp(
+      const std::size_t,
+      const StepType&,
+      const StateType&,
+      const StateType&,
+      const std::size_t = internals::defaultNumberOfSnapshots)  //
+      requires(LoopStepConcept<StepType, StateType>);
+  /*!
+   * \brief compute the derivative of a scalar objective function of the
+   * final state of a loop with respect to the initial state using the
+   * checkpointed reverse mode.
+   *
+   * \param[in] objective: objective function
+   * \param[in] n: number of steps
+   * \param[in] step: step of the loop
+   * \param[in] s0: initial state
+   * \param[in] number_of_snapshots: maximum number of stored states
+   */
+  template <internals::EnzymeCallableConcept ObjectiveType,
+            typename StepType,
+            VariableConcept StateType>
+  auto computeCheckpointedReverseModeDerivative(
+      const ObjectiveType&,
+      const std::size_t,
+      const StepType&,
+      const StateType&,
+      const std::size_t = internals::defaultNumberOfSnapshots)  //
+      requires((LoopStepConcept<StepType, StateType>)&&(
+          ScalarConcept<std::invoke_result_t<ObjectiveType,
+                                             const StateType&>>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/checkpointed_loop.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_CHECKPOINTED_LOOP_HXX */
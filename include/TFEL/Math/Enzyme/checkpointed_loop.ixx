@@ -0,0 +1,190 @@
+/*!
+ * \file   TFEL/Math/Enzyme/checkpointed_loop.ixx
+ * \brief  This file implements the checkpointed_loop function and the
+ * associated functions
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_CHECKPOINTED_LOOP_IXX
+#define LIB_TFEL_MATH_ENZYME_CHECKPOINTED_LOOP_IXX
+
+#include <array>
+#include <utility>
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \return the state at the end of the `k`-th step
+  template <typename StepType, typename StateType>
+  StateType computeLoopStep(const StepType& step,
+                            const StateType& s,
+                            const std::size_t k) {
+    if constexpr (std::is_invocable_r_v<StateType, StepType, const StateType&,
+                                        std::size_t>) {
+      return step(s, k);
+    } else {
+      static_cast<void>(k);
+      return step(s);
+    }
+  }  // end of computeLoopStep
+
+  //! \return the state at the beginning of step `k1` from the one of step `k0`
+  template <typename StepType, typename StateType>
+  StateType advanceLoop(const StepType& step,
+                        const StateType& s,
+                        const std::size_t k0,
+                        const std::size_t k1) {
+    auto r = s;
+    for (auto k = k0; k != k1; ++k) {
+      r = computeLoopStep(step, r, k);
+    }
+    return r;
+  }  // end of advanceLoop
+
+  /*!
+   * \return the cotangent of the state at the beginning of the `k`-th step
+   * from the cotangent `a` of the state at the end of this step
+   */
+  template <typename StepType, typename StateType>
+  StateType computeLoopStepAdjoint(const StepType& step,
+                                   const StateType& s,
+                                   const std::size_t k,
+                                   const StateType& a) {
+    const auto c = [&step, k](const StateType& ws) -> StateType {
+      return computeLoopStep(step, ws, k);
+    };
+    auto r = StateType{};
+    auto dr = std::array<StateType, 1>{a};
+    auto ds = std::array<StateType, 1>{};
+    computeVectorReverseModeGradients(r, ds.data(), c, s, dr.data(),
+                                      std::make_index_sequence<1>{});
+    return ds[0];
+  }  // end of computeLoopStepAdjoint
+
+  /*!
+   * \return the number of steps to be performed before taking a snapshot
+   * when reversing `n` steps with `s` snapshots.
+   *
+   * With `s` snapshots, at most \f$\beta(s, r) = \binom{s+r}{s}\f$ steps can
+   * be reversed if each step is evaluated at most `r` times. If `r` is the
+   * smallest number of evaluations such that \f$\beta(s, r) \geq n\f$, the
+   * snapshot is placed after the step \f$\beta(s, r-1)\f$.
+   */
+  constexpr std::size_t getBinomialCheckpointPosition(
+      const std::size_t n, const std::size_t s) noexcept {
+    auto r = std::size_t{0};
+    auto beta = std::size_t{1};
+    auto previous_beta = std::size_t{1};
+    while (beta < n) {
+      previous_beta = beta;
+      ++r;
+      beta = beta * (s + r) / r;
+    }
+    return previous_beta;
+  }  // end of getBinomialCheckpointPosition
+
+  /*!
+   * \brief reverse the steps `k0` to `k0 + n` of a loop
+   *
+   * The steps after the snapshot are reversed recursively with one snapshot
+   * less, while the steps before the snapshot are reversed iteratively with
+   * the same number of snapshots. Hence, at most one snapshot and one
+   * cotangent are alive per level of recursion, and the number of levels is
+   * bounded by the number of snapshots.
+   *
+   * \param[in] step: step of the loop
+   * \param[in] s: state at the beginning of the step `k0`
+   * \param[in] k0: first step
+   * \param[in] n: number of steps
+   * \param[in] snapshots: number of available snapshots
+   * \param[in] a: cotangent of the state at the end of step `k0 + n - 1`
+   */
+  template <typename StepType, typename StateType>
+  StateType reverseLoop(const StepType& step,
+                        const StateType& s,
+                        const std::size_t k0,
+                        const std::size_t n,
+                        const std::size_t snapshots,
+                        const StateType& a) {
+    auto r = a;
+    auto nr = n;
+    while (nr > 1) {
+      if (snapshots == 0) {
+        // each state is recomputed from the first one
+        for (auto i = nr; i != 1; --i) {
+          const auto k = k0 + i - 1;
+          r = computeLoopStepAdjoint(step, advanceLoop(step, s, k0, k), k, r);
+        }
+        nr = 1;
+        break;
+      }
+      const auto m = getBinomialCheckpointPosition(nr, snapshots);
+      // the snapshot is destroyed before reversing the first `m` steps
+      r = [&step, &s, &r, k0, m, nr, snapshots] {
+        const auto sm = advanceLoop(step, s, k0, k0 + m);
+        return reverseLoop(step, sm, k0 + m, nr - m, snapshots - 1, r);
+      }();
+      nr = m;
+    }
+    if (nr == 1) {
+      r = computeLoopStepAdjoint(step, s, k0, r);
+    }
+    return r;
+  }  // end of reverseLoop
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <typename StepType, VariableConcept StateType>
+  StateType checkpointed_loop(const std::size_t n,
+                              const StepType& step,
+                              const StateType& s0)  //
+      requires(LoopStepConcept<StepType, StateType>) {
+    return internals::advanceLoop(step, s0, 0, n);
+  }  // end of checkpointed_loop
+
+  template <typename StepType, VariableConcept StateType>
+  StateType checkpointed_loop_vjp(const std::size_t n,
+                                  const StepType& step,
+                                  const StateType& s0,
+                                  const StateType& w,
+                                  const std::size_t number_of_snapshots)  //
+      requires(LoopStepConcept<StepType, StateType>) {
+    return internals::reverseLoop(step, s0, 0, n, number_of_snapshots, w);
+  }  // end of checkpointed_loop_vjp
+
+  template <internals::EnzymeCallableConcept ObjectiveType,
+            typename StepType,
+            VariableConcept StateType>
+  auto computeCheckpointedReverseModeDerivative(
+      const ObjectiveType& objective,
+      const std::size_t n,
+      const StepType& step,
+      const StateType& s0,
+      const std::size_t number_of_snapshots)  //
+      requires((LoopStepConcept<StepType, StateType>)&&(
+          ScalarConcept<std::invoke_result_t<ObjectiveType,
+                                             const StateType&>>)) {
+    using ObjectiveResultType =
+        std::invoke_result_t<ObjectiveType, const StateType&>;
+    using DerivativeType = derivative_type<ObjectiveResultType, StateType>;
+    const auto sn = checkpointed_loop(n, step, s0);
+    // the cotangent of the final state, expressed as a shadow of the state
+    const auto w = internals::convertShadow<StateType>(
+        computeReverseModeDerivative(objective, sn));
+    return internals::convertShadow<DerivativeType>(
+        checkpointed_loop_vjp(n, step, s0, w, number_of_snapshots));
+  }  // end of computeCheckpointedReverseModeDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_CHECKPOINTED_LOOP_IXX */
@@ -15,6 +15,7 @@
 #define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVE_HXX
 
 #include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/ModeSelection.hxx"
 
 namespace tfel::math::enzyme {
 
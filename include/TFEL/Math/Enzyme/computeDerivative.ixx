@@ -26,15 +26,17 @@ namespace tfel::math::enzyme {
   auto
   computeDerivative(const CallableType& c, ArgumentsTypes&&... args) requires(
       std::is_invocable_v<CallableType, ArgumentsTypes...>) {
-    if constexpr (m == Mode::REVERSE) {
+    constexpr auto rm =
+        (m == Mode::AUTO) ? getAutomaticMode<CallableType, idx...>() : m;
+    if constexpr (rm == Mode::REVERSE) {
       return computeReverseModeDerivative<idx...>(
           c, std::forward<ArgumentsTypes>(args)...);
-    } else {
-      static_assert(
-          sizeof...(ArgumentsTypes) == 1,
-          "only callable of one variable are supported in forward mode");
+    } else if constexpr (sizeof...(idx) == 0) {
       return computeForwardModeDerivative(
           c, std::forward<ArgumentsTypes>(args)...);
+    } else {
+      return computeForwardModeDerivative<idx...>(
+          c, std::forward<ArgumentsTypes>(args)...);
     }
   }  // end of computeDerivative
 
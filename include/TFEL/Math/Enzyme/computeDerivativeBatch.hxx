@@ -0,0 +1,86 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDerivativeBatch.hxx
+ * \brief  This file declares the computeDerivativeBatch function
+ * \author Thomas Helfer
+ * \date   06/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEBATCH_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEBATCH_HXX
+
+#include <span>
+#include <type_traits>
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+#include "TFEL/Math/Enzyme/ModeSelection.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief traits class describing the types involved in the batched
+   * differentiation of a callable of one variable.
+   */
+  template <typename CallableType,
+            typename ArgumentsList =
+                typename FunctionTraits<CallableType>::type>
+  struct BatchTraits;
+
+  //! \brief partial specialisation for callables of one variable
+  template <typename CallableType, typename CallableArgumentType>
+  struct BatchTraits<CallableType, TypeList<CallableArgumentType>> {
+    //! \brief type of the variable
+    using variable_type = std::decay_t<CallableArgumentType>;
+    //! \brief type of the result
+    using result_type =
+        std::invoke_result_t<CallableType, const variable_type&>;
+    //! \brief type of the derivative
+    using derivative_type =
+        ::tfel::math::derivative_type<result_type, variable_type>;
+  };
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the derivatives of a callable of one variable at many
+   * points.
+   *
+   * The points are treated by blocks of `TFEL_MATH_ENZYME_BATCH_SIZE`
+   * points. The evaluation of the callable over a block is differentiated
+   * by a single call to Enzyme: the seeds of all the points of the block
+   * are packed in the same directions, so that the number of Enzyme calls
+   * per block is the one required to differentiate the callable at one
+   * point.
+   *
+   * \tparam m: differentiation mode
+   * \tparam CallableType: type of the callable
+   * \param[in] c: callable
+   * \param[in] in: values of the variable
+   * \param[out] out: derivatives
+   *
+   * \note an exception is thrown if the sizes of the input and output
+   * spans differ.
+   */
+  template <Mode m, internals::EnzymeCallableConcept CallableType>
+  void computeDerivativeBatch(
+      const CallableType&,
+      std::span<const typename internals::BatchTraits<
+          CallableType>::variable_type>,
+      std::span<typename internals::BatchTraits<CallableType>::derivative_type>)
+      requires(VariableConcept<
+               typename internals::BatchTraits<CallableType>::result_type>);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeDerivativeBatch.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEBATCH_HXX */
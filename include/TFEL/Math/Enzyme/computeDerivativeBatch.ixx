@@ -0,0 +1,246 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDerivativeBatch.ixx
+ * \brief  This file implements the computeDerivativeBatch function
+ * \author Thomas Helfer
+ * \date   06/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEBATCH_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEBATCH_IXX
+
+#include <array>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief return a callable evaluating the given callable on a block of
+   * `B` points.
+   *
+   * \note the callable is captured by reference.
+   */
+  template <std::size_t B,
+            typename VariableType,
+            EnzymeCallableConcept CallableType>
+  auto makeBatchedCallable(const CallableType& c) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    return [&c](const std::array<VariableType, B>& x) {
+      auto r = std::array<ResultType, B>{};
+      for (std::size_t l = 0; l != B; ++l) {
+        r[l] = c(x[l]);
+      }
+      return r;
+    };
+  }  // end of makeBatchedCallable
+
+  /*!
+   * \brief compute the columns `offset` to `offset + w` of the derivatives of
+   * a callable at `B` points using one call to Enzyme's vector forward mode.
+   * The direction `k` seeds the component `offset + k` of all the points.
+   *
+   * \param[out] r: derivatives
+   * \param[in] bc: batched callable
+   * \param[in] x: values of the variable
+   */
+  template <std::size_t offset,
+            std::size_t B,
+            typename DerivativeType,
+            EnzymeCallableConcept BatchedCallableType,
+            typename VariableType>
+  void computeForwardModeDerivativeBatchColumns(
+      std::array<DerivativeType, B>& r,
+      const BatchedCallableType& bc,
+      const std::array<VariableType, B>& x) {
+    using BatchType = std::array<VariableType, B>;
+    using ResultBatchType =
+        std::invoke_result_t<BatchedCallableType, const BatchType&>;
+    using ResultType = typename ResultBatchType::value_type;
+    using value_type = numeric_type<DerivativeType>;
+    constexpr auto n = getVariableSize<VariableType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dx = std::array<BatchType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      for (std::size_t l = 0; l != B; ++l) {
+        setUnitSeed(dx[k][l], offset + k);
+      }
+    }
+    auto v = ResultBatchType{};
+    auto dv = std::array<ResultBatchType, w>{};
+    computeVectorForwardModeIncrements(v, dv.data(), bc,
+                                       TypeList<const BatchType&>{}, x,
+                                       dx.data(), std::make_index_sequence<w>{});
+    for (std::size_t l = 0; l != B; ++l) {
+      if constexpr (ScalarConcept<VariableType>) {
+        r[l] = convertShadow<DerivativeType>(dv[0][l]);
+      } else {
+        using size_type = typename VariableType::size_type;
+        for (std::size_t k = 0; k != w; ++k) {
+          const auto j = static_cast<size_type>(offset + k);
+          if constexpr (ScalarConcept<ResultType>) {
+            r[l](j) = convertShadowValue<value_type>(dv[k][l]);
+          } else {
+            using result_size_type = typename ResultType::size_type;
+            for (result_size_type ri = 0; ri != dv[k][l].size(); ++ri) {
+              r[l](ri, j) = convertShadowValue<value_type>(dv[k][l](ri));
+            }
+          }
+        }
+      }
+    }
+    if constexpr (offset + w < n) {
+      computeForwardModeDerivativeBatchColumns<offset + w>(r, bc, x);
+    }
+  }  // end of computeForwardModeDerivativeBatchColumns
+
+  /*!
+   * \brief compute the rows `offset` to `offset + w` of the derivatives of
+   * a callable returning a math object at `B` points using one call to
+   * Enzyme's vector reverse mode. The direction `k` seeds the component
+   * `offset + k` of the results at all the points.
+   *
+   * \param[out] r: derivatives
+   * \param[in] bc: batched callable
+   * \param[in] x: values of the variable
+   */
+  template <std::size_t offset,
+            std::size_t B,
+            typename DerivativeType,
+            EnzymeCallableConcept BatchedCallableType,
+            typename VariableType>
+  void computeReverseModeDerivativeBatchRows(
+      std::array<DerivativeType, B>& r,
+      const BatchedCallableType& bc,
+      const std::array<VariableType, B>& x) {
+    using BatchType = std::array<VariableType, B>;
+    using ResultBatchType =
+        std::invoke_result_t<BatchedCallableType, const BatchType&>;
+    using ResultType = typename ResultBatchType::value_type;
+    constexpr auto n = getVariableSize<ResultType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dr = std::array<ResultBatchType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      for (std::size_t l = 0; l != B; ++l) {
+        setUnitSeed(dr[k][l], offset + k);
+      }
+    }
+    auto v = ResultBatchType{};
+    auto dx = std::array<BatchType, w>{};
+    computeVectorReverseModeGradients(v, dx.data(), bc, x, dr.data(),
+                                      std::make_index_sequence<w>{});
+    for (std::size_t l = 0; l != B; ++l) {
+      for (std::size_t k = 0; k != w; ++k) {
+        setDerivativeRow(r[l], offset + k, dx[k][l]);
+      }
+    }
+    if constexpr (offset + w < n) {
+      computeReverseModeDerivativeBatchRows<offset + w>(r, bc, x);
+    }
+  }  // end of computeReverseModeDerivativeBatchRows
+
+  /*!
+   * \brief compute the derivatives of a callable at `B` points
+   * \param[out] r: derivatives
+   * \param[in] bc: batched callable
+   * \param[in] x: values of the variable
+   */
+  template <Mode m,
+            std::size_t B,
+            typename DerivativeType,
+            EnzymeCallableConcept BatchedCallableType,
+            typename VariableType>
+  void computeDerivativeBatchBlock(std::array<DerivativeType, B>& r,
+                                   const BatchedCallableType& bc,
+                                   const std::array<VariableType, B>& x) {
+    using BatchType = std::array<VariableType, B>;
+    using ResultBatchType =
+        std::invoke_result_t<BatchedCallableType, const BatchType&>;
+    using ResultType = typename ResultBatchType::value_type;
+    if constexpr (resolveMode<m, ResultType, VariableType>() == Mode::FORWARD) {
+      computeForwardModeDerivativeBatchColumns<0>(r, bc, x);
+    } else if constexpr (ScalarConcept<ResultType>) {
+      // the gradients at all the points are given by one reverse pass
+      auto v = ResultBatchType{};
+      auto dr = std::array<ResultBatchType, 1>{};
+      dr[0].fill(ResultType{1});
+      auto dx = std::array<BatchType, 1>{};
+      computeVectorReverseModeGradients(v, dx.data(), bc, x, dr.data(),
+                                        std::make_index_sequence<1>{});
+      for (std::size_t l = 0; l != B; ++l) {
+        r[l] = convertShadow<DerivativeType>(dx[0][l]);
+      }
+    } else {
+      computeReverseModeDerivativeBatchRows<0>(r, bc, x);
+    }
+  }  // end of computeDerivativeBatchBlock
+
+  /*!
+   * \brief compute the derivatives of a callable at the given points, by
+   * blocks of `B` points.
+   * \param[out] out: derivatives
+   * \param[in] bc: batched callable
+   * \param[in] in: values of the variable
+   * \note the sizes of `in` and `out` are assumed to be equal.
+   */
+  template <Mode m,
+            std::size_t B,
+            typename DerivativeType,
+            EnzymeCallableConcept BatchedCallableType,
+            typename VariableType>
+  void computeDerivativeBatchRange(std::span<DerivativeType> out,
+                                   const BatchedCallableType& bc,
+                                   std::span<const VariableType> in) {
+    auto x = std::array<VariableType, B>{};
+    auto r = std::array<DerivativeType, B>{};
+    for (std::size_t i = 0; i < in.size(); i += B) {
+      const auto nl = std::min(B, in.size() - i);
+      // the remaining points of an incomplete block are filled with copies
+      // of the last valid point, which ensures that the callable is
+      // evaluated at admissible points
+      for (std::size_t l = 0; l != B; ++l) {
+        x[l] = in[i + std::min(l, nl - 1)];
+      }
+      computeDerivativeBatchBlock<m>(r, bc, x);
+      std::copy_n(r.begin(), nl, out.begin() + i);
+    }
+  }  // end of computeDerivativeBatchRange
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <Mode m, internals::EnzymeCallableConcept CallableType>
+  void computeDerivativeBatch(
+      const CallableType& c,
+      std::span<const typename internals::BatchTraits<
+          CallableType>::variable_type> in,
+      std::span<typename internals::BatchTraits<CallableType>::derivative_type>
+          out)
+      requires(VariableConcept<
+               typename internals::BatchTraits<CallableType>::result_type>) {
+    using VariableType =
+        typename internals::BatchTraits<CallableType>::variable_type;
+    using DerivativeType =
+        typename internals::BatchTraits<CallableType>::derivative_type;
+    constexpr auto B = internals::batchSize;
+    tfel::raise_if<std::invalid_argument>(
+        in.size() != out.size(),
+        "computeDerivativeBatch: the number of inputs does not match the "
+        "number of outputs");
+    const auto bc = internals::makeBatchedCallable<B, VariableType>(c);
+    internals::computeDerivativeBatchRange<m, B, DerivativeType>(out, bc, in);
+  }  // end of computeDerivativeBatch
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEBATCH_IXX */
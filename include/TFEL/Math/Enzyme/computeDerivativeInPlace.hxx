@@ -0,0 +1,188 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDerivativeInPlace.hxx
+ * \brief  This file declares the computeDerivativeInPlace and
+ * accumulateDerivative functions
+ * \author Thomas Helfer
+ * \date   07/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEINPLACE_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEINPLACE_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Array/View.hxx"
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+#include "TFEL/Math/Enzyme/ModeSelection.hxx"
+
+namespace tfel::math::enzyme {
+
+  //! \brief policy used to update a caller-provided derivative
+  enum struct UpdatePolicy {
+    //! \brief the previous content of the storage is discarded
+    OVERWRITE,
+    //! \brief the derivative is added to the previous content of the storage
+    ACCUMULATE
+  };
+
+}  // end of namespace tfel::math::enzyme
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief a traits class stating if an object can be used to store a
+   * derivative of the given type, i.e. if it is either an object of this
+   * type or a view mapping an object of this type.
+   */
+  template <typename OutputType, typename DerivativeType>
+  struct IsDerivativeStorage : std::is_same<OutputType, DerivativeType> {};
+
+  //! \brief partial specialisation for views
+  template <typename MappedType,
+            typename IndexingPolicyType,
+            typename DerivativeType>
+  struct IsDerivativeStorage<View<MappedType, IndexingPolicyType>,
+                             DerivativeType>
+      : std::is_same<std::remove_cv_t<MappedType>, DerivativeType> {};
+
+  template <typename OutputType, typename DerivativeType>
+  concept DerivativeStorageConcept =
+      IsDerivativeStorage<std::remove_cvref_t<OutputType>,
+                          DerivativeType>::value;
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the derivative of a callable with respect to the
+   * variable designated by the index `idx` and store it in a caller-provided
+   * object or view.
+   *
+   * The derivative is computed as by `computeDerivative`: Enzyme writes
+   * the tangents (forward mode) or the gradients (reverse mode) of a block
+   * of at most `maximumVectorWidth` columns or rows in local shadows, which
+   * are then copied in the storage. For a derivative of a symmetric tensor
+   * with respect to a symmetric tensor, a single block holds the whole
+   * derivative. Compared to `computeDerivative`, this function only saves
+   * the copy of the derivative returned by value, and allows to write the
+   * derivative in a view on an external buffer.
+   *
+   * \tparam m: differentiation mode
+   * \tparam idx: index of the variable with respect to which the derivative
+   * is computed. This index can be omitted for callables of one variable.
+   * \tparam OutputType: type of the storage
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: types of the arguments passed to the callable
+   * \param[out] r: storage of the derivative
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   *
+   * \note the storage is assumed to be laid out as the derivative type, i.e.
+   * as a row-major array where each row has the layout of the variable.
+   */
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  void computeDerivativeInPlace(OutputType&&,
+                                const CallableType&,
+                                ArgumentsTypes&&...)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>));
+
+  /*!
+   * \brief add the derivative of a callable with respect to the variable
+   * designated by the index `idx` to a caller-provided object or view.
+   *
+   * This function has the same arguments than `computeDerivativeInPlace`.
+   * The components computed by Enzyme are added to the ones of the
+   * storage when they are copied from the local shadows, so that no
+   * temporary derivative has to be created by the caller. It is typically
+   * used to scatter the contribution of one integration point into a
+   * larger matrix.
+   */
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  void accumulateDerivative(OutputType&&,
+                            const CallableType&,
+                            ArgumentsTypes&&...)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>));
+
+  /*!
+   * \brief compute the derivative of a free function with respect to the
+   * variable designated by the index `idx` and store it in a caller-provided
+   * object or view.
+   *
+   * \tparam m: differentiation mode
+   * \tparam idx: index of the variable with respect to which the derivative
+   * is computed
+   * \tparam OutputType: type of the storage
+   * \tparam F: pointer to the free function
+   * \tparam ArgumentsTypes: types of the arguments passed to the free function
+   * \param[out] r: storage of the derivative
+   * \param[in] f: free function wrapper
+   * \param[in] args: arguments passed to the free function
+   */
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  void computeDerivativeInPlace(OutputType&&,
+                                internals::FunctionWrapper<F>,
+                                ArgumentsTypes&&...)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>));
+
+  /*!
+   * \brief add the derivative of a free function with respect to the
+   * variable designated by the index `idx` to a caller-provided object or
+   * view.
+   */
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  void accumulateDerivative(OutputType&&,
+                            internals::FunctionWrapper<F>,
+                            ArgumentsTypes&&...)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeDerivativeInPlace.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEINPLACE_HXX */
@@ -0,0 +1,341 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDerivativeInPlace.ixx
+ * \brief  This file implements the computeDerivativeInPlace and
+ * accumulateDerivative functions
+ * \author Thomas Helfer
+ * \date   07/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEINPLACE_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEINPLACE_IXX
+
+#include <array>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \return a pointer to the first component of a derivative storage
+  template <typename DerivativeType, typename OutputType>
+  numeric_type<DerivativeType>* getDerivativeStorage(OutputType& r) noexcept {
+    if constexpr (ScalarConcept<DerivativeType>) {
+      return &r;
+    } else {
+      return r.data();
+    }
+  }  // end of getDerivativeStorage
+
+  //! \brief update a component of a derivative from a shadow value
+  template <UpdatePolicy p, typename ValueType, typename ShadowValueType>
+  constexpr void updateDerivativeValue(ValueType& v,
+                                       const ShadowValueType& s) noexcept {
+    if constexpr (p == UpdatePolicy::OVERWRITE) {
+      v = convertShadowValue<ValueType>(s);
+    } else {
+      v += convertShadowValue<ValueType>(s);
+    }
+  }  // end of updateDerivativeValue
+
+  /*!
+   * \brief compute the columns `offset` to `offset + w` of the derivative of
+   * a callable using Enzyme's vector forward mode. The tangents are
+   * computed in local shadows of the result, which are then copied in the
+   * given storage.
+   *
+   * \param[out] r: first component of the derivative
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <std::size_t offset,
+            UpdatePolicy p,
+            typename ValueType,
+            EnzymeCallableConcept CallableType,
+            typename VariableType>
+  void computeForwardModeDerivativeColumnsInPlace(ValueType* const r,
+                                                  const CallableType& c,
+                                                  const VariableType& x) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    constexpr auto n = getVariableSize<VariableType>();
+    constexpr auto nr = getVariableSize<ResultType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dx = std::array<VariableType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      if constexpr (ScalarConcept<VariableType>) {
+        dx[k] = VariableType{1};
+      } else {
+        using size_type = typename VariableType::size_type;
+        dx[k][static_cast<size_type>(offset + k)] =
+            numeric_type<VariableType>{1};
+      }
+    }
+    auto v = ResultType{};
+    auto dv = std::array<ResultType, w>{};
+    computeVectorForwardModeIncrements(v, dv.data(), c,
+                                       TypeList<const VariableType&>{}, x,
+                                       dx.data(), std::make_index_sequence<w>{});
+    for (std::size_t k = 0; k != w; ++k) {
+      const auto j = offset + k;
+      if constexpr (ScalarConcept<ResultType>) {
+        updateDerivativeValue<p>(r[j], dv[k]);
+      } else {
+        using result_size_type = typename ResultType::size_type;
+        for (std::size_t ri = 0; ri != nr; ++ri) {
+          updateDerivativeValue<p>(
+              r[ri * n + j], dv[k][static_cast<result_size_type>(ri)]);
+        }
+      }
+    }
+    if constexpr (offset + w < n) {
+      computeForwardModeDerivativeColumnsInPlace<offset + w, p>(r, c, x);
+    }
+  }  // end of computeForwardModeDerivativeColumnsInPlace
+
+  /*!
+   * \brief update a row of a derivative from a shadow of the variable
+   * \param[out] r: first component of the row
+   * \param[in] dx: shadow of the variable
+   */
+  template <UpdatePolicy p, typename ValueType, VariableConcept VariableType>
+  constexpr void updateDerivativeRow(ValueType* const r,
+                                     const VariableType& dx) noexcept {
+    if constexpr (ScalarConcept<VariableType>) {
+      updateDerivativeValue<p>(*r, dx);
+    } else {
+      for (std::size_t j = 0; j != getVariableSize<VariableType>(); ++j) {
+        updateDerivativeValue<p>(r[j], getFlatComponent(dx, j));
+      }
+    }
+  }  // end of updateDerivativeRow
+
+  /*!
+   * \brief compute the rows `offset` to `offset + w` of the derivative of
+   * a callable using Enzyme's vector reverse mode and write them in the
+   * given storage. The gradients are accumulated by Enzyme in local shadows
+   * of the variable, which are then copied in the storage.
+   *
+   * \param[out] r: first component of the derivative
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <std::size_t offset,
+            UpdatePolicy p,
+            typename ValueType,
+            EnzymeCallableConcept CallableType,
+            typename VariableType>
+  void computeReverseModeDerivativeRowsInPlace(ValueType* const r,
+                                               const CallableType& c,
+                                               const VariableType& x) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    constexpr auto n = getVariableSize<ResultType>();
+    constexpr auto nv = getVariableSize<VariableType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dr = std::array<ResultType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      setUnitSeed(dr[k], offset + k);
+    }
+    auto v = ResultType{};
+    auto dx = std::array<VariableType, w>{};
+    computeVectorReverseModeGradients(v, dx.data(), c, x, dr.data(),
+                                      std::make_index_sequence<w>{});
+    for (std::size_t k = 0; k != w; ++k) {
+      updateDerivativeRow<p>(r + (offset + k) * nv, dx[k]);
+    }
+    if constexpr (offset + w < n) {
+      computeReverseModeDerivativeRowsInPlace<offset + w, p>(r, c, x);
+    }
+  }  // end of computeReverseModeDerivativeRowsInPlace
+
+  /*!
+   * \brief compute the derivative of a callable of one variable and write
+   * it in the given storage.
+   * \tparam m: differentiation mode
+   * \tparam p: update policy
+   * \param[out] r: first component of the derivative
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <Mode m,
+            UpdatePolicy p,
+            typename ValueType,
+            EnzymeCallableConcept CallableType,
+            typename VariableType>
+  void computeDerivativeInPlaceImplementation(ValueType* const r,
+                                              const CallableType& c,
+                                              const VariableType& x) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    if constexpr (resolveMode<m, ResultType, VariableType>() == Mode::FORWARD) {
+      computeForwardModeDerivativeColumnsInPlace<0, p>(r, c, x);
+    } else {
+      computeReverseModeDerivativeRowsInPlace<0, p>(r, c, x);
+    }
+  }  // end of computeDerivativeInPlaceImplementation
+
+  template <Mode m,
+            UpdatePolicy p,
+            std::size_t idx,
+            typename OutputType,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  void computeDerivativeInPlaceImplementation(
+      OutputType&& r,
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>,
+      ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (idx < sizeof...(ArgumentsTypes))) {
+    using VariableType = std::decay_t<
+        std::tuple_element_t<idx, std::tuple<CallableArgumentsTypes...>>>;
+    using ResultType = std::invoke_result_t<CallableType, ArgumentsTypes...>;
+    using DerivativeType = derivative_type<ResultType, VariableType>;
+    static_assert(DerivativeStorageConcept<OutputType, DerivativeType>,
+                  "the output must be either the derivative or a view of "
+                  "the derivative");
+    static_assert(sizeof(DerivativeType) ==
+                      getVariableSize<ResultType>() * sizeof(VariableType),
+                  "the rows of the derivative must have the layout of the "
+                  "variable");
+    const auto x = static_cast<VariableType>(
+        std::get<idx>(std::forward_as_tuple(args...)));
+    // the other arguments are considered constant
+    const auto bc = bindAllArgumentsButOne<idx, VariableType>(c, args...);
+    computeDerivativeInPlaceImplementation<m, p>(
+        getDerivativeStorage<DerivativeType>(r), bc, x);
+  }  // end of computeDerivativeInPlaceImplementation
+
+  template <Mode m,
+            UpdatePolicy p,
+            std::size_t... idx,
+            typename OutputType,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes,
+            typename... ArgumentsTypes>
+  void computeDerivativeInPlaceImplementation(
+      OutputType&& r,
+      FunctionWrapper<F>,
+      const TypeList<FunctionArgumentsTypes...>,
+      ArgumentsTypes&&... args)  //
+      requires(std::is_invocable_v<decltype(F), ArgumentsTypes...>) {
+    auto c = [](const FunctionArgumentsTypes... wargs) { return F(wargs...); };
+    if constexpr (sizeof...(idx) == 0) {
+      computeDerivativeInPlaceImplementation<m, p, 0>(
+          r, c, getArgumentsList<decltype(c)>(),
+          std::forward<ArgumentsTypes>(args)...);
+    } else {
+      computeDerivativeInPlaceImplementation<m, p, idx...>(
+          r, c, getArgumentsList<decltype(c)>(),
+          std::forward<ArgumentsTypes>(args)...);
+    }
+  }  // end of computeDerivativeInPlaceImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  void computeDerivativeInPlace(OutputType&& r,
+                                const CallableType& c,
+                                ArgumentsTypes&&... args)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      internals::computeDerivativeInPlaceImplementation<
+          m, UpdatePolicy::OVERWRITE, 0>(
+          r, c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    } else {
+      internals::computeDerivativeInPlaceImplementation<
+          m, UpdatePolicy::OVERWRITE, idx...>(
+          r, c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    }
+  }  // end of computeDerivativeInPlace
+
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  void accumulateDerivative(OutputType&& r,
+                            const CallableType& c,
+                            ArgumentsTypes&&... args)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      internals::computeDerivativeInPlaceImplementation<
+          m, UpdatePolicy::ACCUMULATE, 0>(
+          r, c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    } else {
+      internals::computeDerivativeInPlaceImplementation<
+          m, UpdatePolicy::ACCUMULATE, idx...>(
+          r, c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    }
+  }  // end of accumulateDerivative
+
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  void computeDerivativeInPlace(OutputType&& r,
+                                internals::FunctionWrapper<F> f,
+                                ArgumentsTypes&&... args)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>)) {
+    internals::computeDerivativeInPlaceImplementation<
+        m, UpdatePolicy::OVERWRITE, idx...>(
+        r, f, internals::getArgumentsList<decltype(F)>(),
+        std::forward<ArgumentsTypes>(args)...);
+  }  // end of computeDerivativeInPlace
+
+  template <Mode m,
+            std::size_t... idx,
+            typename OutputType,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  void accumulateDerivative(OutputType&& r,
+                            internals::FunctionWrapper<F> f,
+                            ArgumentsTypes&&... args)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>)) {
+    internals::computeDerivativeInPlaceImplementation<
+        m, UpdatePolicy::ACCUMULATE, idx...>(
+        r, f, internals::getArgumentsList<decltype(F)>(),
+        std::forward<ArgumentsTypes>(args)...);
+  }  // end of accumulateDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEINPLACE_IXX */
@@ -0,0 +1,64 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDerivativeParallel.hxx
+ * \brief  This file declares the computeDerivativeParallel function
+ * \author Thomas Helfer
+ * \date   07/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEPARALLEL_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEPARALLEL_HXX
+
+#include <span>
+#include <cstddef>
+#include "TFEL/Math/Enzyme/computeDerivativeBatch.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the derivatives of a callable of one variable at many
+   * points using several threads.
+   *
+   * The points are split in chunks of several blocks of
+   * `TFEL_MATH_ENZYME_BATCH_SIZE` points. Each thread repeatedly takes the
+   * next chunk not yet treated, so that the load is balanced dynamically
+   * between the threads. Each block is treated as in
+   * `computeDerivativeBatch`.
+   *
+   * The callable is shared by all the threads and is only accessed through
+   * a constant pointer (it is passed to Enzyme as `enzyme_const`). Hence, it
+   * must be safe to call it concurrently, i.e. it must not modify any
+   * shared state. The differentiation of a block does not allocate memory
+   * on the heap nor modify any shared state.
+   *
+   * \tparam m: differentiation mode
+   * \tparam CallableType: type of the callable
+   * \param[in] c: callable
+   * \param[in] in: values of the variable
+   * \param[out] out: derivatives
+   * \param[in] nthreads: number of threads. If null, the number of threads
+   * is given by `std::thread::hardware_concurrency`.
+   *
+   * \note an exception is thrown if the sizes of the input and output
+   * spans differ.
+   */
+  template <Mode m, internals::EnzymeCallableConcept CallableType>
+  void computeDerivativeParallel(
+      const CallableType&,
+      std::span<const typename internals::BatchTraits<
+          CallableType>::variable_type>,
+      std::span<typename internals::BatchTraits<CallableType>::derivative_type>,
+      const std::size_t = 0)
+      requires(VariableConcept<
+               typename internals::BatchTraits<CallableType>::result_type>);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeDerivativeParallel.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEPARALLEL_HXX */
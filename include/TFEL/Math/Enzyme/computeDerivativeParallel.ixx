@@ -0,0 +1,90 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDerivativeParallel.ixx
+ * \brief  This file implements the computeDerivativeParallel function
+ * \author Thomas Helfer
+ * \date   07/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEPARALLEL_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEPARALLEL_IXX
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "TFEL/Raise.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \brief number of blocks of points in a chunk treated by a thread
+  inline constexpr std::size_t numberOfBlocksPerChunk = 16;
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <Mode m, internals::EnzymeCallableConcept CallableType>
+  void computeDerivativeParallel(
+      const CallableType& c,
+      std::span<const typename internals::BatchTraits<
+          CallableType>::variable_type> in,
+      std::span<typename internals::BatchTraits<CallableType>::derivative_type>
+          out,
+      const std::size_t nthreads)
+      requires(VariableConcept<
+               typename internals::BatchTraits<CallableType>::result_type>) {
+    using VariableType =
+        typename internals::BatchTraits<CallableType>::variable_type;
+    using DerivativeType =
+        typename internals::BatchTraits<CallableType>::derivative_type;
+    constexpr auto B = internals::batchSize;
+    static constexpr auto chunk_size = B * internals::numberOfBlocksPerChunk;
+    tfel::raise_if<std::invalid_argument>(
+        in.size() != out.size(),
+        "computeDerivativeParallel: the number of inputs does not match the "
+        "number of outputs");
+    const auto nchunks = (in.size() + chunk_size - 1) / chunk_size;
+    const auto nt = std::min(
+        nthreads != 0
+            ? nthreads
+            : std::max(std::size_t{1},
+                       static_cast<std::size_t>(
+                           std::thread::hardware_concurrency())),
+        nchunks);
+    // the batched callable only holds a reference to the callable
+    const auto bc = internals::makeBatchedCallable<B, VariableType>(c);
+    auto next_chunk = std::atomic<std::size_t>{0};
+    auto worker = [&bc, &next_chunk, &in, &out, nchunks] {
+      auto ic = next_chunk.fetch_add(1, std::memory_order_relaxed);
+      while (ic < nchunks) {
+        const auto first = ic * chunk_size;
+        const auto n = std::min(chunk_size, in.size() - first);
+        internals::computeDerivativeBatchRange<m, B, DerivativeType>(
+            out.subspan(first, n), bc, in.subspan(first, n));
+        ic = next_chunk.fetch_add(1, std::memory_order_relaxed);
+      }
+    };
+    if (nt <= 1) {
+      worker();
+      return;
+    }
+    auto threads = std::vector<std::jthread>{};
+    threads.reserve(nt - 1);
+    for (std::size_t i = 0; i + 1 < nt; ++i) {
+      threads.emplace_back(worker);
+    }
+    // the calling thread also takes part in the computation
+    worker();
+    // the threads are joined by the destructor of std::jthread
+  }  // end of computeDerivativeParallel
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDERIVATIVEPARALLEL_IXX */
@@ -0,0 +1,73 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDirectionalDerivative.hxx
+ * \brief  This file declares the computeDirectionalDerivative function
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDIRECTIONALDERIVATIVE_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDIRECTIONALDERIVATIVE_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the `k`-th derivative of the univariate restriction
+   * \f$t \mapsto c(x + t\,v)\f$ of a callable of one variable at \f$t=0\f$.
+   *
+   * The restriction is differentiated by `k` nested forward passes with
+   * respect to the scalar \f$t\f$. The cost does not depend on the size
+   * of the variable, but it is about \f$2^{k}\f$ evaluations of the
+   * callable, since each pass differentiates the previous one.
+   *
+   * \tparam k: order of the derivative
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] v: direction
+   * \return the `k`-th directional derivative, which has the type of the
+   * result of the callable.
+   */
+  template <std::size_t k,
+            internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeDirectionalDerivative(const CallableType&,
+                                    const ArgumentType&,
+                                    const DirectionType&)  //
+      requires((k > 0) &&
+               (internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>));
+  /*!
+   * \brief compute the `k`-th directional derivative of a free function of
+   * one variable.
+   * \tparam k: order of the derivative
+   * \tparam F: pointer to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] x: value of the variable
+   * \param[in] v: direction
+   */
+  template <std::size_t k,
+            internals::IsFunctionPointerConcept auto F,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeDirectionalDerivative(internals::FunctionWrapper<F>,
+                                    const ArgumentType&,
+                                    const DirectionType&)  //
+      requires((k > 0) &&
+               (std::is_invocable_v<decltype(F), const ArgumentType&>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeDirectionalDerivative.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDIRECTIONALDERIVATIVE_HXX */
@@ -0,0 +1,112 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeDirectionalDerivative.ixx
+ * \brief  This file implements the computeDirectionalDerivative function
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEDIRECTIONALDERIVATIVE_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEDIRECTIONALDERIVATIVE_IXX
+
+#include <type_traits>
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \return the `k`-th derivative of a univariate callable
+   *
+   * The derivative is computed by `k` nested forward passes, each pass
+   * differentiating the previous one. Each level doubles the number of
+   * evaluations, so the cost is about \f$2^{k}\f$ evaluations of the
+   * callable, and `k` nested calls to Enzyme are instantiated.
+   *
+   * \param[in] g: callable
+   * \param[in] t: value of the variable
+   */
+  template <std::size_t k, EnzymeCallableConcept CallableType, typename RealType>
+  auto differentiateUnivariateFunction(const CallableType& g,
+                                       const RealType t) {
+    if constexpr (k == 0) {
+      return g(t);
+    } else {
+      const auto dg = [&g](const RealType wt) {
+        return ::tfel::math::enzyme::fwddiff(
+            g, make_vdv<RealType>(wt, RealType{1}));
+      };
+      return differentiateUnivariateFunction<k - 1>(dg, t);
+    }
+  }  // end of differentiateUnivariateFunction
+
+  template <std::size_t k,
+            EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeDirectionalDerivativeImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentType>&,
+      const ArgumentType& x,
+      const DirectionType& v) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    using real = base_type<numeric_type<VariableType>>;
+    const auto g = [&c, &x, &v](const real t) {
+      const VariableType y = x + t * v;
+      return c(y);
+    };
+    return differentiateUnivariateFunction<k>(g, real{0});
+  }  // end of computeDirectionalDerivativeImplementation
+
+  template <std::size_t k,
+            IsFunctionPointerConcept auto F,
+            typename FunctionArgumentType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeDirectionalDerivativeImplementation(
+      FunctionWrapper<F>,
+      const TypeList<FunctionArgumentType>& args_list,
+      const ArgumentType& x,
+      const DirectionType& v) {
+    auto c = [](const FunctionArgumentType warg) { return F(warg); };
+    return computeDirectionalDerivativeImplementation<k>(c, args_list, x, v);
+  }  // end of computeDirectionalDerivativeImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <std::size_t k,
+            internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeDirectionalDerivative(const CallableType& c,
+                                    const ArgumentType& x,
+                                    const DirectionType& v)  //
+      requires((k > 0) &&
+               (internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)) {
+    return internals::computeDirectionalDerivativeImplementation<k>(
+        c, internals::getArgumentsList<CallableType>(), x, v);
+  }  // end of computeDirectionalDerivative
+
+  template <std::size_t k,
+            internals::IsFunctionPointerConcept auto F,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeDirectionalDerivative(internals::FunctionWrapper<F> f,
+                                    const ArgumentType& x,
+                                    const DirectionType& v)  //
+      requires((k > 0) &&
+               (std::is_invocable_v<decltype(F), const ArgumentType&>)) {
+    return internals::computeDirectionalDerivativeImplementation<k>(
+        f, internals::getArgumentsList<decltype(F)>(), x, v);
+  }  // end of computeDirectionalDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEDIRECTIONALDERIVATIVE_IXX */
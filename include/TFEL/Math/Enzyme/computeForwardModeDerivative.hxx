@@ -14,15 +14,59 @@
 #ifndef LIB_TFEL_MATH_ENZYME_COMPUTEFORWARDMODEDERIVATIVE_HXX
 #define LIB_TFEL_MATH_ENZYME_COMPUTEFORWARDMODEDERIVATIVE_HXX
 
+#include <cstddef>
 #include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/PackedDerivatives.hxx"
 
 namespace tfel::math::enzyme {
 
-  template <internals::EnzymeCallableConcept CallableType,
+  /*!
+   * \brief compute the derivative of a callable using the forward mode.
+   *
+   * If the callable takes several arguments, the derivatives with respect to
+   * all the arguments are computed and returned in a `PackedDerivatives`
+   * object.
+   *
+   * \tparam s: treatment of the symmetry of the derivative. The derivative
+   * can only be symmetrized for callables of one variable returning a math
+   * object of the size of the variable.
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: type of the arguments passed to the callable
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   */
+  template <Symmetry s = Symmetry::NONE,
+            internals::EnzymeCallableConcept CallableType,
             typename... ArgumentsTypes>
   auto
   computeForwardModeDerivative(const CallableType&, ArgumentsTypes&&...) requires(
       std::is_invocable_v<CallableType, ArgumentsTypes...>);
+  /*!
+   * \brief compute the derivative of a callable with respect to the
+   * arguments `idx0, idx...` using the forward mode, the other arguments
+   * being held constant.
+   *
+   * If several indices are given, the increments of all the selected
+   * arguments are carried by the same vector forward passes, and the
+   * derivatives are returned in a `PackedDerivatives` object, in the order of
+   * the indices.
+   *
+   * \tparam idx0: index of the first argument
+   * \tparam idx: indices of the other arguments
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: type of the arguments passed to the callable
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   */
+  template <std::size_t idx0,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  auto computeForwardModeDerivative(const CallableType&,
+                                    ArgumentsTypes&&...)  //
+      requires((idx0 < sizeof...(ArgumentsTypes)) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>));
 
 }  // end of namespace tfel::math::enzyme
 
@@ -14,62 +14,318 @@
 #ifndef LIB_TFEL_MATH_ENZYME_COMPUTEFORWARDMODEDERIVATIVE_IXX
 #define LIB_TFEL_MATH_ENZYME_COMPUTEFORWARDMODEDERIVATIVE_IXX
 
+#include <array>
+#include <tuple>
+#include <utility>
+#include <algorithm>
 #include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/PackedDerivatives.hxx"
+#include "TFEL/Math/Enzyme/Internals/ActiveArguments.hxx"
 
 namespace tfel::math::enzyme::internals {
 
+  /*!
+   * \brief compute the increments of a callable of one variable in
+   * `sizeof...(i)` directions using one call to Enzyme's vector forward mode.
+   * The primal function is evaluated only once.
+   *
+   * \tparam CallableType: type of the callable
+   * \tparam CallableArgumentType: type of the argument of the callable
+   * \tparam VariableType: type of the variable
+   * \tparam ResultType: type of the result of the callable
+   * \param[out] r: value of the callable
+   * \param[out] dr: increments of the callable
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] dx: increments of the variable
+   */
   template <EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename VariableType,
+            typename ResultType,
+            std::size_t... i>
+  void computeVectorForwardModeIncrements(ResultType& r,
+                                          ResultType* const dr,
+                                          const CallableType& c,
+                                          const TypeList<CallableArgumentType>&,
+                                          const VariableType& x,
+                                          const VariableType* const dx,
+                                          const std::index_sequence<i...>&) {
+    static_assert(sizeof...(i) > 0);
+    auto wrapper = [](const CallableType* const ptr,
+                      const VariableType* const warg,
+                      ResultType* const wr) {
+      *wr = (*ptr)(static_cast<CallableArgumentType>(*warg));
+    };
+    void* const wrapper_ptr = reinterpret_cast<void*>(+wrapper);
+    const void* const c_ptr = reinterpret_cast<const void*>(&c);
+    __enzyme_fwddiff<void>(wrapper_ptr, enzyme_width,
+                           static_cast<int>(sizeof...(i)),  //
+                           enzyme_const, c_ptr,             //
+                           enzyme_dup, &x, (dx + i)...,     //
+                           enzyme_dup, &r, (dr + i)...);
+  }  // end of computeVectorForwardModeIncrements
+
+  /*!
+   * \brief compute the columns `offset` to `offset + w` of the derivative of
+   * a callable with respect to a math object using Enzyme's vector forward
+   * mode, where `w` is bounded by `maximumVectorWidth`.
+   *
+   * \param[out] v: value of the callable
+   * \param[out] r: derivative of the callable
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <std::size_t offset,
+            Symmetry s,
+            EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename DerivativeResultType>
+  void computeForwardModeDerivativeColumns(
+      std::invoke_result_t<CallableType, CallableArgumentType>& v,
+      DerivativeResultType& r,
+      const CallableType& c,
+      const TypeList<CallableArgumentType>& args_list,
+      const std::decay_t<CallableArgumentType>& x) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    using ResultType = std::invoke_result_t<CallableType, CallableArgumentType>;
+    using size_type = typename VariableType::size_type;
+    using value_type = numeric_type<DerivativeResultType>;
+    constexpr auto n = getVariableSize<VariableType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dx = std::array<VariableType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      dx[k][static_cast<size_type>(offset + k)] =
+          numeric_type<VariableType>{1};
+    }
+    auto dv = std::array<ResultType, w>{};
+    computeVectorForwardModeIncrements(v, dv.data(), c, args_list, x,
+                                       dx.data(),
+                                       std::make_index_sequence<w>{});
+    for (std::size_t k = 0; k != w; ++k) {
+      const auto j = static_cast<size_type>(offset + k);
+      if constexpr (ScalarConcept<ResultType>) {
+        r(j) = convertShadowValue<value_type>(dv[k]);
+      } else {
+        using result_size_type = typename ResultType::size_type;
+        if constexpr (s == Symmetry::SYMMETRIZE) {
+          static_assert(getVariableSize<ResultType>() == n,
+                        "symmetrization requires the result and the variable "
+                        "to have the same size");
+          // the upper triangular part of the column is mirrored
+          for (result_size_type ri = 0; ri <= j; ++ri) {
+            r(ri, j) = convertShadowValue<value_type>(dv[k](ri));
+            r(j, ri) = r(ri, j);
+          }
+        } else {
+          for (result_size_type ri = 0; ri != dv[k].size(); ++ri) {
+            r(ri, j) = convertShadowValue<value_type>(dv[k](ri));
+          }
+        }
+      }
+    }
+    if constexpr (offset + w < n) {
+      computeForwardModeDerivativeColumns<offset + w, s>(v, r, c, args_list,
+                                                     x);
+    }
+  }  // end of computeForwardModeDerivativeColumns
+
+  template <Symmetry s,
+            EnzymeCallableConcept CallableType,
             typename CallableArgumentType0,
             typename ArgumentType0>
   auto computeForwardModeDerivativeImplementation(
       const CallableType& c,
-      const TypeList<CallableArgumentType0>&,
+      const TypeList<CallableArgumentType0>& args_list,
       ArgumentType0&&
           arg0) requires(std::is_invocable_v<CallableType, ArgumentType0>) {
     using ResultType =
         std::invoke_result_t<CallableType, CallableArgumentType0>;
     using DerivativeResultType =
         derivative_type<ResultType, std::decay_t<CallableArgumentType0>>;
-    if constexpr (ScalarConcept<CallableArgumentType0>) {
+    if constexpr (ScalarConcept<std::decay_t<CallableArgumentType0>>) {
       // derivative with respect to a scalar
       auto vdv = VariableValueAndIncrement<std::decay_t<CallableArgumentType0>>{
           .value = arg0, .increment = 1};
       return fwddiff(c, vdv);
-    } else if constexpr (ScalarConcept<ResultType>) {
-      auto vdv = VariableValueAndIncrement<std::decay_t<CallableArgumentType0>>{
-          .value = arg0, .increment = {}};
+    } else {
+      // derivative with respect to a MathObject: all the columns of the
+      // derivative are computed by a single vector forward pass when the
+      // size of the variable does not exceed maximumVectorWidth
+      const std::decay_t<CallableArgumentType0> x = arg0;
+      auto v = ResultType{};
       auto r = DerivativeResultType{};
-      for (typename std::decay_t<CallableArgumentType0>::size_type i = 0;
-           i != vdv.value.size(); ++i) {
-        vdv.increment[i] = 1;
-        const auto dc = fwddiff(c, vdv);
-        r(i) = dc;
-        vdv.increment[i] = 0;
-      }
+      computeForwardModeDerivativeColumns<0, s>(v, r, c, args_list, x);
       return r;
+    }
+  }  // end of computeForwardModeDerivativeImplementation
+
+  /*!
+   * \brief store the `g`-th column of the derivatives with respect to the
+   * active arguments in the derivative with respect to the active argument
+   * whose first component has index `o`, if this column belongs to it.
+   *
+   * \tparam VariableType: type of the active argument
+   * \param[out] d: derivative with respect to the active argument
+   * \param[in] dv: increment of the callable
+   * \param[in] g: index of the column
+   * \param[in] o: index of the first component of the active argument
+   */
+  template <typename VariableType, typename DerivativeType, typename ResultType>
+  void storeForwardModeDerivativeColumn(DerivativeType& d,
+                                        const ResultType& dv,
+                                        const std::size_t g,
+                                        const std::size_t o) {
+    constexpr auto n = getVariableSize<VariableType>();
+    if ((g < o) || (g >= o + n)) {
+      return;
+    }
+    if constexpr (ScalarConcept<VariableType>) {
+      d = convertShadow<DerivativeType>(dv);
     } else {
-      // derivative with respect to a MathObject
-      auto vdv = VariableValueAndIncrement<std::decay_t<CallableArgumentType0>>{
-          .value = arg0, .increment = {}};
-      auto r = DerivativeResultType{};
-      for (typename std::decay_t<CallableArgumentType0>::size_type i = 0;
-           i != r.size(0); ++i) {
-        vdv.increment[i] = 1;
-        const auto dc = fwddiff(c, vdv);
-        for (typename ResultType::size_type j = 0; j != vdv.value.size(); ++j) {
-          r(i, j) = dc(j);
+      using value_type = numeric_type<DerivativeType>;
+      using size_type = typename VariableType::size_type;
+      const auto j = static_cast<size_type>(g - o);
+      if constexpr (ScalarConcept<ResultType>) {
+        d(j) = convertShadowValue<value_type>(dv);
+      } else {
+        using result_size_type = typename ResultType::size_type;
+        for (result_size_type ri = 0; ri != dv.size(); ++ri) {
+          d(ri, j) = convertShadowValue<value_type>(dv(ri));
         }
-        vdv.increment[i] = 0;
       }
-      return r;
     }
+  }  // end of storeForwardModeDerivativeColumn
+
+  /*!
+   * \brief compute the columns `offset` to `offset + w` of the derivatives of
+   * a callable with respect to its active arguments using Enzyme's vector
+   * forward mode, where `w` is bounded by `maximumVectorWidth`.
+   *
+   * The columns of all the active arguments are numbered consecutively, so
+   * that one vector forward pass may carry increments of several arguments.
+   *
+   * \param[out] r: derivatives of the callable
+   * \param[in] bc: callable of the active arguments
+   * \param[in] x: values of the active arguments
+   */
+  template <std::size_t offset,
+            EnzymeCallableConcept BoundCallableType,
+            typename ActiveArgumentsType,
+            typename... DerivativesTypes>
+  void computeForwardModeDerivativesColumns(
+      PackedDerivatives<DerivativesTypes...>& r,
+      const BoundCallableType& bc,
+      const ActiveArgumentsType& x) {
+    using ResultType =
+        std::invoke_result_t<BoundCallableType, const ActiveArgumentsType&>;
+    constexpr auto n = getActiveArgumentsSize<ActiveArgumentsType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dx = std::array<ActiveArgumentsType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      setActiveArgumentsSeed(dx[k], offset + k);
+    }
+    auto v = ResultType{};
+    auto dv = std::array<ResultType, w>{};
+    computeVectorForwardModeIncrements(
+        v, dv.data(), bc, TypeList<const ActiveArgumentsType&>{}, x,
+        dx.data(), std::make_index_sequence<w>{});
+    for (std::size_t k = 0; k != w; ++k) {
+      [&r, &dv, k ]<std::size_t... a>(const std::index_sequence<a...>&) {
+        (storeForwardModeDerivativeColumn<
+             std::tuple_element_t<a, ActiveArgumentsType>>(
+             get<a>(r), dv[k], offset + k,
+             getActiveArgumentOffset<a, ActiveArgumentsType>()),
+         ...);
+      }
+      (std::make_index_sequence<sizeof...(DerivativesTypes)>{});
+    }
+    if constexpr (offset + w < n) {
+      computeForwardModeDerivativesColumns<offset + w>(r, bc, x);
+    }
+  }  // end of computeForwardModeDerivativesColumns
+
+  /*!
+   * \brief compute the derivative of a callable with respect to the
+   * argument `idx`, the other arguments being held constant.
+   */
+  template <Symmetry s,
+            std::size_t idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeForwardModeDerivativeImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>& args_list,
+      ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (idx < sizeof...(ArgumentsTypes))) {
+    if constexpr (sizeof...(ArgumentsTypes) == 1) {
+      return computeForwardModeDerivativeImplementation<s>(
+          c, args_list, std::forward<ArgumentsTypes>(args)...);
+    } else {
+      using VariableType = std::decay_t<
+          std::tuple_element_t<idx, std::tuple<CallableArgumentsTypes...>>>;
+      const VariableType x = std::get<idx>(std::forward_as_tuple(args...));
+      const auto bc = bindAllArgumentsButOne<idx, VariableType>(c, args...);
+      return computeForwardModeDerivativeImplementation<s>(
+          bc, TypeList<const VariableType&>{}, x);
+    }
+  }  // end of computeForwardModeDerivativeImplementation
+
+  /*!
+   * \brief compute the derivatives of a callable with respect to the
+   * arguments `idx`, the other arguments being held constant. All the
+   * derivatives are computed by the same vector forward passes.
+   */
+  template <Symmetry s,
+            std::size_t idx0,
+            std::size_t idx1,
+            std::size_t... idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeForwardModeDerivativeImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>& args_list,
+      ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (idx0 < sizeof...(ArgumentsTypes)) &&
+               (idx1 < sizeof...(ArgumentsTypes)) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...)) {
+    static_assert(s == Symmetry::NONE,
+                  "symmetries are not supported when differentiating "
+                  "with respect to several arguments");
+    using ArgumentsValuesType = std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<idx0, ArgumentsValuesType>,
+                   std::tuple_element_t<idx1, ArgumentsValuesType>,
+                   std::tuple_element_t<idx, ArgumentsValuesType>...>;
+    using ResultType = std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    using DerivativesType = PackedDerivatives<
+        derivative_type<ResultType,
+                        std::tuple_element_t<idx0, ArgumentsValuesType>>,
+        derivative_type<ResultType,
+                        std::tuple_element_t<idx1, ArgumentsValuesType>>,
+        derivative_type<ResultType,
+                        std::tuple_element_t<idx, ArgumentsValuesType>>...>;
+    const auto v = ArgumentsValuesType{std::forward<ArgumentsTypes>(args)...};
+    const auto x = ActiveArgumentsType{std::get<idx0>(v), std::get<idx1>(v),
+                                       std::get<idx>(v)...};
+    const auto bc = bindInactiveArguments<idx0, idx1, idx...>(c, args_list, v);
+    auto r = DerivativesType{};
+    computeForwardModeDerivativesColumns<0>(r, bc, x);
+    return r;
   }  // end of computeForwardModeDerivativeImplementation
 
 }  // end of namespace tfel::math::enzyme::internals
 
 namespace tfel::math::enzyme {
 
-  template <internals::EnzymeCallableConcept CallableType,
+  template <Symmetry s,
+            internals::EnzymeCallableConcept CallableType,
             typename... ArgumentsTypes>
   auto computeForwardModeDerivative(
       const CallableType& c,
@@ -77,9 +333,34 @@ namespace tfel::math::enzyme {
                                              is_invocable_v<
                                                  CallableType,
                                                  ArgumentsTypes...>) {
-    static_assert(sizeof...(ArgumentsTypes) == 1,
-                  "only callable of one variable are supported");
-    return internals::computeForwardModeDerivativeImplementation(
+    if constexpr (sizeof...(ArgumentsTypes) == 1) {
+      return internals::computeForwardModeDerivativeImplementation<s>(
+          c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    } else {
+      // derivatives with respect to all the arguments
+      return [&c, &args...]<std::size_t... idx>(
+          const std::index_sequence<idx...>&) {
+        return internals::computeForwardModeDerivativeImplementation<s,
+                                                                     idx...>(
+            c, internals::getArgumentsList<CallableType>(),
+            std::forward<ArgumentsTypes>(args)...);
+      }
+      (std::index_sequence_for<ArgumentsTypes...>{});
+    }
+  }  // end of computeForwardModeDerivative
+
+  template <std::size_t idx0,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  auto computeForwardModeDerivative(const CallableType& c,
+                                    ArgumentsTypes&&... args)  //
+      requires((idx0 < sizeof...(ArgumentsTypes)) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)) {
+    return internals::computeForwardModeDerivativeImplementation<
+        Symmetry::NONE, idx0, idx...>(
         c, internals::getArgumentsList<CallableType>(),
         std::forward<ArgumentsTypes>(args)...);
   }  // end of computeForwardModeDerivative
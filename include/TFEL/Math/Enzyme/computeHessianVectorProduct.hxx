@@ -0,0 +1,71 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeHessianVectorProduct.hxx
+ * \brief  This file declares the computeHessianVectorProduct function
+ * \author Thomas Helfer
+ * \date   11/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEHESSIANVECTORPRODUCT_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEHESSIANVECTORPRODUCT_HXX
+
+#include <type_traits>
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the product of the hessian of a scalar callable of one
+   * variable by a direction, without building the hessian.
+   *
+   * The product is computed by forward-over-reverse differentiation: the
+   * reverse pass computing the gradient is differentiated by a single
+   * forward pass in the given direction. Its cost is thus about the cost of
+   * two evaluations of the gradient, whatever the size of the variable.
+   *
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentType: type of the argument
+   * \tparam DirectionType: type of the direction
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] v: direction
+   */
+  template <internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeHessianVectorProduct(const CallableType&,
+                                   const ArgumentType&,
+                                   const DirectionType&)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)&&(
+                   ScalarConcept<std::invoke_result_t<CallableType,
+                                                      const ArgumentType&>>));
+  /*!
+   * \brief compute the product of the hessian of a scalar free function of
+   * one variable by a direction.
+   * \tparam F: pointer to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] x: value of the variable
+   * \param[in] v: direction
+   */
+  template <internals::IsFunctionPointerConcept auto F,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeHessianVectorProduct(internals::FunctionWrapper<F>,
+                                   const ArgumentType&,
+                                   const DirectionType&)  //
+      requires((std::is_invocable_v<decltype(F), const ArgumentType&>)&&(
+          ScalarConcept<
+              std::invoke_result_t<decltype(F), const ArgumentType&>>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeHessianVectorProduct.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEHESSIANVECTORPRODUCT_HXX */
@@ -0,0 +1,82 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeHessianVectorProduct.ixx
+ * \brief  This file implements the computeHessianVectorProduct function
+ * \author Thomas Helfer
+ * \date   11/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEHESSIANVECTORPRODUCT_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEHESSIANVECTORPRODUCT_IXX
+
+namespace tfel::math::enzyme::internals {
+
+  template <EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeHessianVectorProductImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentType>&,
+      const ArgumentType& x,
+      const DirectionType& v) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    // gradient computed by a single reverse pass
+    const auto dc = [&c](const VariableType& wx) {
+      return ::tfel::math::enzyme::computeReverseModeDerivative(c, wx);
+    };
+    return ::tfel::math::enzyme::fwddiff(dc, make_vdv<VariableType>(x, v));
+  }  // end of computeHessianVectorProductImplementation
+
+  template <IsFunctionPointerConcept auto F,
+            typename FunctionArgumentType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeHessianVectorProductImplementation(
+      FunctionWrapper<F>,
+      const TypeList<FunctionArgumentType>& args_list,
+      const ArgumentType& x,
+      const DirectionType& v) {
+    auto c = [](const FunctionArgumentType warg) { return F(warg); };
+    return computeHessianVectorProductImplementation(c, args_list, x, v);
+  }  // end of computeHessianVectorProductImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeHessianVectorProduct(const CallableType& c,
+                                   const ArgumentType& x,
+                                   const DirectionType& v)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)&&(
+                   ScalarConcept<std::invoke_result_t<CallableType,
+                                                      const ArgumentType&>>)) {
+    return internals::computeHessianVectorProductImplementation(
+        c, internals::getArgumentsList<CallableType>(), x, v);
+  }  // end of computeHessianVectorProduct
+
+  template <internals::IsFunctionPointerConcept auto F,
+            typename ArgumentType,
+            typename DirectionType>
+  auto computeHessianVectorProduct(internals::FunctionWrapper<F> f,
+                                   const ArgumentType& x,
+                                   const DirectionType& v)  //
+      requires((std::is_invocable_v<decltype(F), const ArgumentType&>)&&(
+          ScalarConcept<
+              std::invoke_result_t<decltype(F), const ArgumentType&>>)) {
+    return internals::computeHessianVectorProductImplementation(
+        f, internals::getArgumentsList<decltype(F)>(), x, v);
+  }  // end of computeHessianVectorProduct
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEHESSIANVECTORPRODUCT_IXX */
@@ -17,7 +17,11 @@ namespace tfel::math::enzyme {
 
   /*!
    * \brief compute the derivative of a callable with respect to the variables
-   * designated by the indices `idx`
+   * designated by the indices `idx`. For callables returning a scalar, all
+   * the derivatives are computed by a single reverse pass, whatever the
+   * number of arguments. If more than one index is given, the derivatives
+   * are returned in a `PackedDerivatives` object, in the order of the
+   * indices.
    * \tparam idx: indices of the variables with respect to which the derivatives
    * are computed. \tparam CallableType: type of the callable \tparam
    * ArgumentsTypes: types of the arguments passed to the callable \param[in] c:
@@ -29,7 +33,6 @@ namespace tfel::math::enzyme {
   auto computeReverseModeDerivative(const CallableType&,
                                   ArgumentsTypes&&...)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -64,7 +67,6 @@ namespace tfel::math::enzyme {
   auto computeReverseModeDerivative(internals::FunctionWrapper<F>,
                                   ArgumentsTypes&&...)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -8,71 +8,14 @@
 #ifndef LIB_TFEL_MATH_ENZYME_COMPUTEREVERSEMODEDERIVATIVE_IXX
 #define LIB_TFEL_MATH_ENZYME_COMPUTEREVERSEMODEDERIVATIVE_IXX
 
+#include <array>
 #include <tuple>
+#include <algorithm>
 #include <utility>
 #include <type_traits>
 #include "TFEL/Math/General/DerivativeType.hxx"
-
-namespace tfel::math::enzyme::internals {
-
-  template <std::size_t N, typename DerivativeType>
-  struct DerivativeHolder {
-    DerivativeType value;
-  };
-
-  template <std::size_t N,
-            typename CurrentDerivativeType,
-            typename... DerivativesTypes>
-  struct PackedDerivativesImplementation
-      : DerivativeHolder<N, CurrentDerivativeType>,
-        PackedDerivativesImplementation<N + 1, DerivativesTypes...> {};
-
-  template <std::size_t N, typename DerivativeType>
-  struct PackedDerivativesImplementation<N, DerivativeType>
-      : DerivativeHolder<N, DerivativeType> {};
-
-}  // namespace tfel::math::enzyme::internals
-
-namespace tfel::math::enzyme {
-
-  template <typename... DerivativesTypes>
-  struct PackedDerivatives
-      : internals::PackedDerivativesImplementation<0, DerivativesTypes...> {};
-
-  template <std::size_t N, typename... DerivativesTypes>
-  auto& get(PackedDerivatives<DerivativesTypes...>& derivatives) noexcept  //
-      requires(N < sizeof...(DerivativesTypes)) {
-    using DerivativeType =
-        std::tuple_element_t<N, std::tuple<DerivativesTypes...>>;
-    return static_cast<internals::DerivativeHolder<N, DerivativeType>&>(derivatives)
-        .value;
-  }  // end of get
-
-  template <std::size_t N, typename... DerivativesTypes>
-  const auto& get(
-      const PackedDerivatives<DerivativesTypes...>& derivatives) noexcept  //
-      requires(N < sizeof...(DerivativesTypes)) {
-    using DerivativeType =
-        std::tuple_element_t<N, std::tuple<DerivativesTypes...>>;
-    return static_cast<const internals::DerivativeHolder<N, DerivativeType>&>(
-               derivatives)
-        .value;
-  }  // end of get
-
-}  // end of namespace tfel::math::enzyme
-
-namespace std {
-
-  template <typename... DerivativesTypes>
-  struct tuple_size<::tfel::math::enzyme::PackedDerivatives<DerivativesTypes...>>
-      : integral_constant<size_t, sizeof...(DerivativesTypes)> {};
-
-  template <std::size_t N, typename... DerivativesTypes>
-  struct tuple_element<N,
-                       ::tfel::math::enzyme::PackedDerivatives<DerivativesTypes...>>
-      : tuple_element<N, std::tuple<DerivativesTypes...>> {};
-
-}  // namespace std
+#include "TFEL/Math/Enzyme/PackedDerivatives.hxx"
+#include "TFEL/Math/Enzyme/Internals/ActiveArguments.hxx"
 
 namespace tfel::math::enzyme::internals {
 
@@ -82,7 +25,6 @@ namespace tfel::math::enzyme::internals {
   auto computeReverseModeScalarFunctionDerivative(const CallableType&,
                                                 ArgumentsTypes&&...)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -104,7 +46,6 @@ namespace tfel::math::enzyme::internals {
   auto computeReverseModeScalarFunctionDerivative(internals::FunctionWrapper<F>,
                                                 ArgumentsTypes&&...)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -152,133 +93,87 @@ namespace tfel::math::enzyme::internals {
     }
   }
 
-  template <std::size_t N, std::size_t... idx>
-  constexpr void checkRedundancy() noexcept requires(sizeof...(idx) > 0) {
-    const auto n = (((idx == N) ? 1 : 0) + ...);
-    static_assert(n < 2, "redundant indices detected");
-    if constexpr (N > 0) {
-      return checkRedundancy<N - 1, idx...>();
-    }
-  }
-
+  /*!
+   * \brief convert the shadows of the active arguments to derivatives
+   * \param[out] r: derivatives
+   * \param[in] dx: shadows of the active arguments
+   */
+  template <typename... DerivativesTypes,
+            typename ActiveArgumentsType,
+            std::size_t... k>
+  void convertShadows(PackedDerivatives<DerivativesTypes...>& r,
+                      const ActiveArgumentsType& dx,
+                      const std::index_sequence<k...>&) {
+    ((get<k>(r) = convertShadow<DerivativesTypes>(std::get<k>(dx))), ...);
+  }  // end of convertShadows
+
+  /*!
+   * \brief compute the gradients of a callable returning a scalar with
+   * respect to an arbitrary subset of its arguments using one reverse pass.
+   *
+   * The active arguments are gathered in a tuple which is duplicated, so
+   * that the list of arguments passed to Enzyme does not depend on the
+   * arity of the callable nor on the selected arguments. All the other
+   * arguments are passed as a constant tuple.
+   *
+   * \return the derivative with respect to the selected argument if only one
+   * argument is selected, and `PackedDerivatives` object holding the
+   * derivatives in the order of the indices `idx` otherwise.
+   */
   template <std::size_t... idx,
             EnzymeCallableConcept CallableType,
-            typename CallableArgumentType0,
-            typename CallableArgumentType1,
-            typename ArgumentType0,
-            typename ArgumentType1>
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
   auto computeReverseModeScalarFunctionDerivativeImplementation(
       const CallableType& c,
-      const TypeList<CallableArgumentType0, CallableArgumentType1>&,
-      ArgumentType0&& arg0,
-      ArgumentType1&& arg1)  //
-      requires((std::is_invocable_v<CallableType,
-                                    ArgumentType0,
-                                    ArgumentType1>)&&  //
-               (sizeof...(idx) > 0) &&                 //
-               (sizeof...(idx) <= 2) &&                //
-               ((idx < 2) && ...)) {
+      const TypeList<CallableArgumentsTypes...>&,
+      ArgumentsTypes&&... args)  //
+      requires((std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&  //
+               (sizeof...(idx) > 0) &&         //
+               ((idx < sizeof...(ArgumentsTypes)) && ...)) {
     using CallableResultType =
-        std::invoke_result_t<CallableType, CallableArgumentType0,
-                             CallableArgumentType1>;
-    checkCallEnzymeArgumentsConsistency(
-        TypeList<CallableArgumentType0, CallableArgumentType1>{},
-        TypeList<ArgumentType0, ArgumentType1>{});
-    auto wrapper =
-        [](const CallableType* const c, const CallableArgumentType0 wargs0,
-           const CallableArgumentType1 wargs1) { return (*c)(wargs0, wargs1); };
+        std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    using ArgumentsValuesType =
+        std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<idx, ArgumentsValuesType>...>;
+    static_assert((isConvertible<ArgumentsTypes, CallableArgumentsTypes>() &&
+                   ...),
+                  "arguments are not compatible with the arguments of the "
+                  "callable");
+    checkRedundancy<sizeof...(ArgumentsTypes) - 1, idx...>();
+    const auto v = ArgumentsValuesType{
+        static_cast<std::decay_t<CallableArgumentsTypes>>(args)...};
+    const auto x = ActiveArgumentsType{std::get<idx>(v)...};
+    auto dx = ActiveArgumentsType{};
+    auto wrapper = [](const CallableType* const wc,
+                      const ActiveArgumentsType* const wx,
+                      const ArgumentsValuesType* const wv) {
+      return callWithActiveArguments<idx...>(
+          *wc, TypeList<CallableArgumentsTypes...>{}, *wx, *wv,
+          std::make_index_sequence<sizeof...(CallableArgumentsTypes)>{});
+    };
     void* const wrapper_ptr = reinterpret_cast<void*>(+wrapper);
     const void* const c_ptr = reinterpret_cast<const void*>(&c);
-    checkRedundancy<1, idx...>();
-    constexpr auto b0 = ((idx == 0) || ...);
-    constexpr auto b1 = ((idx == 1) || ...);
-    if constexpr ((b0) && (!b1)) {
-      using ResultType = derivative_type<CallableResultType,
-                                         std::decay_t<CallableArgumentType0>>;
-      if constexpr (ScalarConcept<std::decay_t<CallableArgumentType0>>) {
-        return __enzyme_autodiff<ResultType>(
-            wrapper_ptr, enzyme_const, c_ptr,  //
-            enzyme_out,
-            convertToEnzymeArgument<CallableArgumentType0>(arg0),  //
-            enzyme_const, convertToEnzymeArgument<CallableArgumentType1>(arg1));
-      } else {
-        auto r = ResultType{};
-        __enzyme_autodiff<void>(
-            wrapper_ptr, enzyme_const, c_ptr,  //
-            enzyme_dup, convertToEnzymeArgument<CallableArgumentType0>(arg0),
-            &r,  //
-            enzyme_const, convertToEnzymeArgument<CallableArgumentType1>(arg1));
-        return r;
-      }
-    } else if constexpr ((!b0) && (b1)) {
-      using ResultType = derivative_type<CallableResultType,
-                                         std::decay_t<CallableArgumentType1>>;
-      if constexpr (ScalarConcept<std::decay_t<CallableArgumentType1>>) {
-        return __enzyme_autodiff<ResultType>(
-            wrapper_ptr, enzyme_const,
-            c_ptr,  //
-            enzyme_const,
-            convertToEnzymeArgument<CallableArgumentType0>(arg0),  //
-            enzyme_out, convertToEnzymeArgument<CallableArgumentType1>(arg1));
-      } else {
-        auto r = ResultType{};
-        __enzyme_autodiff<void>(
-            wrapper_ptr, enzyme_const,
-            c_ptr,  //
-            enzyme_const,
-            convertToEnzymeArgument<CallableArgumentType0>(arg0),  //
-            enzyme_dup, convertToEnzymeArgument<CallableArgumentType1>(arg1),
-            &r);
-        return r;
-      }
+    __enzyme_autodiff<void>(wrapper_ptr,          //
+                            enzyme_const, c_ptr,  //
+                            enzyme_dup, &x, &dx,  //
+                            enzyme_const, &v);
+    if constexpr (sizeof...(idx) == 1) {
+      using DerivativeType = derivative_type<
+          CallableResultType, std::tuple_element_t<0, ActiveArgumentsType>>;
+      return convertShadow<DerivativeType>(std::get<0>(dx));
     } else {
-      using DerivativeType0 =
-          derivative_type<CallableResultType,
-                          std::decay_t<CallableArgumentType0>>;
-      using DerivativeType1 =
-          derivative_type<CallableResultType,
-                          std::decay_t<CallableArgumentType1>>;
-      using ResultType = PackedDerivatives<DerivativeType0, DerivativeType1>;
-      if constexpr ((ScalarConcept<std::decay_t<CallableArgumentType0>>)&&  //
-                    (ScalarConcept<std::decay_t<CallableArgumentType1>>)) {
-        return __enzyme_autodiff<ResultType>(
-            wrapper_ptr, enzyme_const,
-            c_ptr,  //
-            enzyme_out,
-            convertToEnzymeArgument<CallableArgumentType0>(arg0),  //
-            enzyme_out, convertToEnzymeArgument<CallableArgumentType1>(arg1));
-      } else if constexpr (ScalarConcept<std::decay_t<CallableArgumentType0>>) {
-        auto r = ResultType{};
-        std::get<0>(r) = __enzyme_autodiff<DerivativeType0>(
-            wrapper_ptr, enzyme_const,
-            c_ptr,  //
-            enzyme_out,
-            convertToEnzymeArgument<CallableArgumentType0>(arg0),  //
-            enzyme_dup, convertToEnzymeArgument<CallableArgumentType1>(arg1),
-            &(get<1>(r)));
-        return r;
-      } else if constexpr (ScalarConcept<std::decay_t<CallableArgumentType1>>) {
-        auto r = ResultType{};
-        std::get<1>(r) = __enzyme_autodiff<DerivativeType1>(
-            wrapper_ptr, enzyme_const,
-            c_ptr,  //
-            enzyme_dup, convertToEnzymeArgument<CallableArgumentType0>(arg0),
-            &(get<0>(r)),  //
-            enzyme_out, convertToEnzymeArgument<CallableArgumentType1>(arg1));
-        return r;
-      } else {
-        auto r = ResultType{};
-        __enzyme_autodiff<void>(
-            wrapper_ptr, enzyme_const,
-            c_ptr,  //
-            enzyme_dup, convertToEnzymeArgument<CallableArgumentType0>(arg0),
-            &(get<0>(r)),  //
-            enzyme_dup, convertToEnzymeArgument<CallableArgumentType1>(arg1),
-            &(get<1>(r)));
-        return r;
-      }
+      using ResultType = PackedDerivatives<derivative_type<
+          CallableResultType,
+          std::tuple_element_t<idx, ArgumentsValuesType>>...>;
+      auto r = ResultType{};
+      convertShadows(r, dx, std::make_index_sequence<sizeof...(idx)>{});
+      return r;
     }
-  }
+  }  // end of computeReverseModeScalarFunctionDerivativeImplementation
 
   template <std::size_t... idx,
             EnzymeCallableConcept CallableType,
@@ -286,7 +181,6 @@ namespace tfel::math::enzyme::internals {
   auto computeReverseModeScalarFunctionDerivative(const CallableType& c,
                                                 ArgumentsTypes&&... args)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -298,13 +192,93 @@ namespace tfel::math::enzyme::internals {
       return computeReverseModeScalarFunctionDerivativeImplementation(
           c, getArgumentsList<CallableType>(),
           std::forward<ArgumentsTypes>(args)...);
-    } else if constexpr (nargs == 2) {
+    } else {
       return computeReverseModeScalarFunctionDerivativeImplementation<idx...>(
           c, getArgumentsList<CallableType>(),
           std::forward<ArgumentsTypes>(args)...);
     }
   }  // end of computeReverseModeScalarFunctionDerivative
 
+  /*!
+   * \brief compute the gradients of `sizeof...(i)` components of the result of
+   * a callable of one variable using one call to Enzyme's vector reverse mode.
+   * The primal function is evaluated only once.
+   *
+   * \tparam CallableType: type of the callable
+   * \tparam VariableType: type of the variable
+   * \tparam ResultType: type of the result of the callable
+   * \param[out] r: value of the callable
+   * \param[out] dx: gradients of the selected components
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] dr: adjoints of the result of the callable, i.e. the seeds of
+   * the reverse sweep. Those values are reset to zero by Enzyme.
+   */
+  template <EnzymeCallableConcept CallableType,
+            typename VariableType,
+            typename ResultType,
+            std::size_t... i>
+  void computeVectorReverseModeGradients(ResultType& r,
+                                         VariableType* const dx,
+                                         const CallableType& c,
+                                         const VariableType& x,
+                                         ResultType* const dr,
+                                         const std::index_sequence<i...>&) {
+    static_assert(sizeof...(i) > 0);
+    auto wrapper = [](const CallableType* const ptr,
+                      const VariableType* const warg,
+                      ResultType* const wr) { *wr = (*ptr)(*warg); };
+    void* const wrapper_ptr = reinterpret_cast<void*>(+wrapper);
+    const void* const c_ptr = reinterpret_cast<const void*>(&c);
+    __enzyme_autodiff<void>(wrapper_ptr, enzyme_width,
+                            static_cast<int>(sizeof...(i)),  //
+                            enzyme_const, c_ptr,             //
+                            enzyme_dup, &x, (dx + i)...,     //
+                            enzyme_dup, &r, (dr + i)...);
+  }  // end of computeVectorReverseModeGradients
+
+  /*!
+   * \brief compute the rows `offset` to `offset + w` of the derivative of
+   * a callable returning a math object using Enzyme's vector reverse mode,
+   * where `w` is bounded by `maximumVectorWidth`.
+   *
+   * The result of the callable and the variable may have any arity: the
+   * rows of the derivative are indexed by the flat index of the components
+   * of the result and the columns by the flat index of the components of
+   * the variable, see `setDerivativeRow`.
+   *
+   * \param[out] v: value of the callable
+   * \param[out] r: derivative of the callable
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <std::size_t offset,
+            typename DerivativeResultType,
+            EnzymeCallableConcept CallableType,
+            typename VariableType>
+  void computeReverseModeDerivativeRows(
+      std::invoke_result_t<CallableType, const VariableType&>& v,
+      DerivativeResultType& r,
+      const CallableType& c,
+      const VariableType& x) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    constexpr auto n = getVariableSize<ResultType>();
+    constexpr auto w = std::min(n - offset, maximumVectorWidth);
+    auto dr = std::array<ResultType, w>{};
+    for (std::size_t k = 0; k != w; ++k) {
+      setUnitSeed(dr[k], offset + k);
+    }
+    auto dx = std::array<VariableType, w>{};
+    computeVectorReverseModeGradients(v, dx.data(), c, x, dr.data(),
+                                      std::make_index_sequence<w>{});
+    for (std::size_t k = 0; k != w; ++k) {
+      setDerivativeRow(r, offset + k, dx[k]);
+    }
+    if constexpr (offset + w < n) {
+      computeReverseModeDerivativeRows<offset + w>(v, r, c, x);
+    }
+  }  // end of computeReverseModeDerivativeRows
+
   template <std::size_t idx,
             EnzymeCallableConcept CallableType,
             typename... CallableArgumentsTypes,
@@ -324,39 +298,13 @@ namespace tfel::math::enzyme::internals {
     using CallableResultType =
         std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
     using ResultType = derivative_type<CallableResultType, VariableType>;
-    constexpr auto callable_result_arity =
-        CallableResultType::indexing_policy::arity;
-    using size_type = typename ResultType::size_type;
+    const auto x = static_cast<VariableType>(
+        std::get<idx>(std::forward_as_tuple(args...)));
+    // the other arguments are considered constant
+    const auto bc = bindAllArgumentsButOne<idx, VariableType>(c, args...);
+    auto v = CallableResultType{};
     auto r = ResultType{};
-    static_assert(callable_result_arity == 1);
-    for (size_type i = 0; i != r.size(0); ++i) {
-      auto wrapper = [c, i](CallableArgumentsTypes... wargs) {
-        auto result = c(wargs...);
-        return result[i];
-      };
-      const auto row = computeReverseModeDerivative<idx>(wrapper, args...);
-      if constexpr (ScalarConcept<decltype(row)>) {
-        // derivation with respect to a scalar
-        r[i] = row;
-      } else {
-        // derivation with respect to a math object
-        constexpr auto variable_result_arity =
-            VariableType::indexing_policy::arity;
-        static_assert((variable_result_arity == 1) ||
-                      (variable_result_arity == 2));
-        if constexpr (variable_result_arity == 1) {
-          for (size_type vj = 0; vj != row.size(); ++vj) {
-            r(i, vj) = row[vj];
-          }
-        } else {
-          for (size_type vj = 0; vj != row.size(0); ++vj) {
-            for (size_type vk = 0; vk != row.size(0); ++vk) {
-              r(i, vj, vk) = row(vj, vk);
-            }
-          }
-        }
-      }
-    }
+    computeReverseModeDerivativeRows<0>(v, r, bc, x);
     return r;
   }  // end of computeReverseModeMathObjectFunctionDerivative
 
@@ -410,7 +358,6 @@ namespace tfel::math::enzyme {
   auto computeReverseModeDerivative(const CallableType& c,
                                   ArgumentsTypes&&... args)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -438,7 +385,6 @@ namespace tfel::math::enzyme {
   auto computeReverseModeDerivative(internals::FunctionWrapper<F> f,
                                   ArgumentsTypes&&... args)  //
       requires((sizeof...(ArgumentsTypes) > 0) &&
-               (sizeof...(ArgumentsTypes) < 3) &&  //
                (sizeof...(idx) > 0) &&
                (sizeof...(idx) <= sizeof...(ArgumentsTypes)) &&
                ((idx < sizeof...(ArgumentsTypes)) && ...) &&
@@ -0,0 +1,55 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeSparseForwardModeDerivative.hxx
+ * \brief  This file declares the computeSparseForwardModeDerivative function
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTESPARSEFORWARDMODEDERIVATIVE_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTESPARSEFORWARDMODEDERIVATIVE_HXX
+
+#include <type_traits>
+#include "TFEL/Math/Enzyme/SparsityPattern.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the derivative of a callable of one variable whose
+   * jacobian has a known sparsity pattern.
+   *
+   * The columns of the jacobian are colored at compile-time by the
+   * `computeColumnColoring` function and the increments of the variable
+   * associated with the columns of one color are propagated by the same
+   * forward direction. The number of directions is thus the number of
+   * colors rather than the size of the variable. The entries outside the
+   * sparsity pattern are set to zero.
+   *
+   * \tparam pattern: sparsity pattern of the jacobian
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentType: type of the argument
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <auto pattern,
+            internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType>
+  auto computeSparseForwardModeDerivative(const CallableType&,
+                                          const ArgumentType&)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)&&(
+                   MathObjectConcept<std::invoke_result_t<
+                       CallableType,
+                       const ArgumentType&>>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeSparseForwardModeDerivative.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTESPARSEFORWARDMODEDERIVATIVE_HXX */
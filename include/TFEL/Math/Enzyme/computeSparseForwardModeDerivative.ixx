@@ -0,0 +1,137 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeSparseForwardModeDerivative.ixx
+ * \brief  This file implements the computeSparseForwardModeDerivative
+ * function
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTESPARSEFORWARDMODEDERIVATIVE_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTESPARSEFORWARDMODEDERIVATIVE_IXX
+
+#include <array>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Math/General/DerivativeType.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief compute the columns of the colors `offset` to `offset + w` of the
+   * derivative of a callable using Enzyme's vector forward mode, where `w`
+   * is bounded by `maximumVectorWidth`.
+   *
+   * \param[out] v: value of the callable
+   * \param[out] r: derivative of the callable
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <std::size_t offset,
+            auto pattern,
+            EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename DerivativeResultType>
+  void computeSparseForwardModeDerivativeColumns(
+      std::invoke_result_t<CallableType, CallableArgumentType>& v,
+      DerivativeResultType& r,
+      const CallableType& c,
+      const TypeList<CallableArgumentType>& args_list,
+      const std::decay_t<CallableArgumentType>& x) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    using ResultType = std::invoke_result_t<CallableType, CallableArgumentType>;
+    using size_type = typename VariableType::size_type;
+    using result_size_type = typename ResultType::size_type;
+    using value_type = numeric_type<DerivativeResultType>;
+    constexpr auto coloring = computeColumnColoring(pattern);
+    constexpr auto nc = coloring.number_of_colors;
+    constexpr auto w = std::min(nc - offset, maximumVectorWidth);
+    // seeds: one direction per color
+    auto dx = std::array<VariableType, w>{};
+    for (std::size_t j = 0; j != pattern.number_of_columns; ++j) {
+      const auto k = coloring.colors[j];
+      if ((k >= offset) && (k < offset + w)) {
+        setUnitSeed(dx[k - offset], j);
+      }
+    }
+    auto dv = std::array<ResultType, w>{};
+    computeVectorForwardModeIncrements(v, dv.data(), c, args_list, x,
+                                       dx.data(),
+                                       std::make_index_sequence<w>{});
+    // decompression
+    for (std::size_t j = 0; j != pattern.number_of_columns; ++j) {
+      const auto k = coloring.colors[j];
+      if ((k < offset) || (k >= offset + w)) {
+        continue;
+      }
+      const auto cj = static_cast<size_type>(j);
+      for (std::size_t i = 0; i != pattern.number_of_rows; ++i) {
+        const auto ri = static_cast<result_size_type>(i);
+        r(ri, cj) = pattern(i, j)
+                        ? convertShadowValue<value_type>(dv[k - offset](ri))
+                        : value_type{0};
+      }
+    }
+    if constexpr (offset + w < nc) {
+      computeSparseForwardModeDerivativeColumns<offset + w, pattern>(
+          v, r, c, args_list, x);
+    }
+  }  // end of computeSparseForwardModeDerivativeColumns
+
+  template <auto pattern,
+            EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename ArgumentType>
+  auto computeSparseForwardModeDerivativeImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentType>& args_list,
+      const ArgumentType& arg) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    using ResultType = std::invoke_result_t<CallableType, CallableArgumentType>;
+    using DerivativeType = derivative_type<ResultType, VariableType>;
+    static_assert(MathObjectConcept<VariableType>,
+                  "the variable must be a math object");
+    static_assert((VariableType::indexing_policy::arity == 1) &&
+                      (ResultType::indexing_policy::arity == 1),
+                  "only math objects of arity one are supported");
+    static_assert(pattern.number_of_rows == getVariableSize<ResultType>(),
+                  "the number of rows of the sparsity pattern does not match "
+                  "the size of the result");
+    static_assert(
+        pattern.number_of_columns == getVariableSize<VariableType>(),
+        "the number of columns of the sparsity pattern does not match the "
+        "size of the variable");
+    const auto x = static_cast<VariableType>(arg);
+    auto v = ResultType{};
+    auto r = DerivativeType{};
+    computeSparseForwardModeDerivativeColumns<0, pattern>(v, r, c, args_list,
+                                                          x);
+    return r;
+  }  // end of computeSparseForwardModeDerivativeImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <auto pattern,
+            internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType>
+  auto computeSparseForwardModeDerivative(const CallableType& c,
+                                          const ArgumentType& x)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)&&(
+                   MathObjectConcept<std::invoke_result_t<
+                       CallableType,
+                       const ArgumentType&>>)) {
+    return internals::computeSparseForwardModeDerivativeImplementation<
+        pattern>(c, internals::getArgumentsList<CallableType>(), x);
+  }  // end of computeSparseForwardModeDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTESPARSEFORWARDMODEDERIVATIVE_IXX */
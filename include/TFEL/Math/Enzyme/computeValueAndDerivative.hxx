@@ -0,0 +1,92 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeValueAndDerivative.hxx
+ * \brief  This file declares the computeValueAndDerivative function
+ * \author Thomas Helfer
+ * \date   05/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEVALUEANDDERIVATIVE_HXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEVALUEANDDERIVATIVE_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+#include "TFEL/Math/Enzyme/ModeSelection.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief a simple structure containing the value of a callable and its
+   * derivative with respect to one variable
+   */
+  template <typename ValueType, typename DerivativeType>
+  struct ValueAndDerivative {
+    //! \brief value of the callable
+    ValueType value;
+    //! \brief derivative of the callable
+    DerivativeType derivative;
+  };
+
+  /*!
+   * \brief compute the value of a callable and its derivative with respect to
+   * the variable designated by the index `idx` using a single call to Enzyme,
+   * so that the callable is evaluated only once per vector pass.
+   *
+   * \tparam m: differentiation mode
+   * \tparam idx: index of the variable with respect to which the derivative
+   * is computed. This index can be omitted for callables of one variable.
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: types of the arguments passed to the callable
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   */
+  template <Mode m,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  auto computeValueAndDerivative(const CallableType&, ArgumentsTypes&&...)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>));
+
+  /*!
+   * \brief compute the value of a free function and its derivative with
+   * respect to the variable designated by the index `idx`.
+   *
+   * \tparam m: differentiation mode
+   * \tparam idx: index of the variable with respect to which the derivative
+   * is computed
+   * \tparam F: pointer to the free function
+   * \tparam ArgumentsTypes: types of the arguments passed to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] args: arguments passed to the free function
+   */
+  template <Mode m,
+            std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto computeValueAndDerivative(internals::FunctionWrapper<F>,
+                                 ArgumentsTypes&&...)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>));
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/computeValueAndDerivative.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEVALUEANDDERIVATIVE_HXX */
@@ -0,0 +1,154 @@
+/*!
+ * \file   TFEL/Math/Enzyme/computeValueAndDerivative.ixx
+ * \brief  This file implements the computeValueAndDerivative function
+ * \author Thomas Helfer
+ * \date   05/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_COMPUTEVALUEANDDERIVATIVE_IXX
+#define LIB_TFEL_MATH_ENZYME_COMPUTEVALUEANDDERIVATIVE_IXX
+
+#include <array>
+#include <tuple>
+#include <utility>
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief compute the value and the derivative of a callable of one
+   * variable.
+   * \tparam m: differentiation mode
+   * \tparam s: symmetry of the derivative. This parameter is only used in
+   * forward mode.
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   */
+  template <Mode m,
+            Symmetry s = Symmetry::NONE,
+            EnzymeCallableConcept CallableType,
+            typename VariableType>
+  auto computeValueAndDerivativeImplementation(const CallableType& c,
+                                               const VariableType& x) {
+    using ResultType = std::invoke_result_t<CallableType, const VariableType&>;
+    using DerivativeType = derivative_type<ResultType, VariableType>;
+    auto r = ValueAndDerivative<ResultType, DerivativeType>{};
+    if constexpr (resolveMode<m, ResultType, VariableType>() == Mode::FORWARD) {
+      const auto args_list = TypeList<const VariableType&>{};
+      if constexpr (ScalarConcept<VariableType>) {
+        auto dx = std::array<VariableType, 1>{VariableType{1}};
+        auto dv = std::array<ResultType, 1>{};
+        computeVectorForwardModeIncrements(r.value, dv.data(), c, args_list,
+                                           x, dx.data(),
+                                           std::make_index_sequence<1>{});
+        r.derivative = convertShadow<DerivativeType>(dv[0]);
+      } else {
+        computeForwardModeDerivativeColumns<0, s>(r.value, r.derivative, c,
+                                                  args_list, x);
+      }
+    } else {
+      if constexpr (ScalarConcept<ResultType>) {
+        auto dr = std::array<ResultType, 1>{ResultType{1}};
+        auto dx = std::array<VariableType, 1>{};
+        computeVectorReverseModeGradients(r.value, dx.data(), c, x, dr.data(),
+                                          std::make_index_sequence<1>{});
+        r.derivative = convertShadow<DerivativeType>(dx[0]);
+      } else {
+        computeReverseModeDerivativeRows<0>(r.value, r.derivative, c, x);
+      }
+    }
+    return r;
+  }  // end of computeValueAndDerivativeImplementation
+
+  template <Mode m,
+            std::size_t idx,
+            Symmetry s = Symmetry::NONE,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeValueAndDerivativeImplementation(
+      const CallableType& c,
+      const TypeList<CallableArgumentsTypes...>,
+      ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (idx < sizeof...(ArgumentsTypes))) {
+    using VariableType = std::decay_t<
+        std::tuple_element_t<idx, std::tuple<CallableArgumentsTypes...>>>;
+    const auto x = static_cast<VariableType>(
+        std::get<idx>(std::forward_as_tuple(args...)));
+    // the other arguments are considered constant
+    const auto bc = bindAllArgumentsButOne<idx, VariableType>(c, args...);
+    return computeValueAndDerivativeImplementation<m, s>(bc, x);
+  }  // end of computeValueAndDerivativeImplementation
+
+  template <Mode m,
+            std::size_t... idx,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto computeValueAndDerivativeImplementation(
+      FunctionWrapper<F>,
+      const TypeList<FunctionArgumentsTypes...>,
+      ArgumentsTypes&&... args)  //
+      requires(std::is_invocable_v<decltype(F), ArgumentsTypes...>) {
+    auto c = [](const FunctionArgumentsTypes... wargs) { return F(wargs...); };
+    return ::tfel::math::enzyme::computeValueAndDerivative<m, idx...>(
+        c, std::forward<ArgumentsTypes>(args)...);
+  }  // end of computeValueAndDerivativeImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <Mode m,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes>
+  auto computeValueAndDerivative(const CallableType& c,
+                                 ArgumentsTypes&&... args)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<CallableType, ArgumentsTypes...>>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      return internals::computeValueAndDerivativeImplementation<m, 0>(
+          c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    } else {
+      return internals::computeValueAndDerivativeImplementation<m, idx...>(
+          c, internals::getArgumentsList<CallableType>(),
+          std::forward<ArgumentsTypes>(args)...);
+    }
+  }  // end of computeValueAndDerivative
+
+  template <Mode m,
+            std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto computeValueAndDerivative(internals::FunctionWrapper<F> f,
+                                 ArgumentsTypes&&... args)  //
+      requires(((sizeof...(idx) == 1) ||
+                ((sizeof...(idx) == 0) && (sizeof...(ArgumentsTypes) == 1))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<decltype(F), ArgumentsTypes...>)&&  //
+               (VariableConcept<
+                   std::invoke_result_t<decltype(F), ArgumentsTypes...>>)) {
+    return internals::computeValueAndDerivativeImplementation<m, idx...>(
+        f, internals::getArgumentsList<decltype(F)>(),
+        std::forward<ArgumentsTypes>(args)...);
+  }  // end of computeValueAndDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_COMPUTEVALUEANDDERIVATIVE_IXX */
@@ -37,7 +37,7 @@ namespace tfel::math::enzyme {
 
   /*!
    * \brief compute the increment of a callable given the values the variables
-   * and the increment of one of these variables.
+   * and the increments of some of these variables.
    * \tparam CallableType: type of the callable
    * \tparam ArgumentType0: type of the first argument
    * \tparam ArgumentType1: type of the second argument
@@ -45,7 +45,9 @@ namespace tfel::math::enzyme {
    * \param[in] arg0: first argument
    * \param[in] arg1: second argument
    * \return the callable increment
-   * \note One and only one argument must be a VariableValueAndIncrement object.
+   * \note At least one argument must be a VariableValueAndIncrement object.
+   * The increments of all such arguments are propagated by a single call to
+   * `__enzyme_fwddiff`.
    */
   template <internals::EnzymeCallableConcept CallableType,
             typename ArgumentType0,
@@ -55,7 +57,7 @@ namespace tfel::math::enzyme {
 
   /*!
    * \brief compute the increment of a callable given the values the variables
-   * and the increment of one of these variables.
+   * and the increments of some of these variables.
    * \tparam CallableType: type of the callable
    * \tparam ArgumentType0: type of the first argument
    * \tparam ArgumentType1: type of the second argument
@@ -65,7 +67,9 @@ namespace tfel::math::enzyme {
    * \param[in] arg1: second argument
    * \param[in] arg2: third argument
    * \return the callable increment
-   * \note One and only one argument must be a VariableValueAndIncrement object.
+   * \note At least one argument must be a VariableValueAndIncrement object.
+   * The increments of all such arguments are propagated by a single call to
+   * `__enzyme_fwddiff`.
    */
   template <internals::EnzymeCallableConcept CallableType,
             typename ArgumentType0,
@@ -80,7 +84,7 @@ namespace tfel::math::enzyme {
 
   /*!
    * \brief compute the increment of a callable given the values the variables
-   * and the increment of one of these variables.
+   * and the increments of some of these variables.
    * \tparam CallableType: type of the callable
    * \tparam ArgumentType0: type of the first argument
    * \tparam ArgumentType1: type of the second argument
@@ -92,7 +96,9 @@ namespace tfel::math::enzyme {
    * \param[in] arg2: third argument
    * \param[in] arg3: fourth argument
    * \return the callable increment
-   * \note One and only one argument must be a VariableValueAndIncrement object.
+   * \note At least one argument must be a VariableValueAndIncrement object.
+   * The increments of all such arguments are propagated by a single call to
+   * `__enzyme_fwddiff`.
    */
   template <internals::EnzymeCallableConcept CallableType,
             typename ArgumentType0,
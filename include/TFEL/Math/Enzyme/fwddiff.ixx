@@ -14,7 +14,11 @@
 #ifndef LIB_TFEL_MATH_ENZYME_FWDDIFF_IXX
 #define LIB_TFEL_MATH_ENZYME_FWDDIFF_IXX 1
 
+#include <array>
+#include <tuple>
+#include <utility>
 #include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/ActiveArguments.hxx"
 
 namespace tfel::math::enzyme::internals {
 
@@ -25,10 +29,8 @@ namespace tfel::math::enzyme::internals {
       requires(sizeof...(CallableArgumentsTypes) == sizeof...(ArgumentsTypes)) {
     static_assert(
         countNumberOfVariableValueAndIncrement<ArgumentsTypes...>() != 0u,
-        "one argument of type VariableValueAndIncrement is expected");
-    static_assert(
-        countNumberOfVariableValueAndIncrement<ArgumentsTypes...>() == 1u,
-        "only one argument of type VariableValueAndIncrement is expected");
+        "at least one argument of type VariableValueAndIncrement is "
+        "expected");
   }  // end of checkCallEnzymeFwdDiffArguments
 
   template <typename CallableType,
@@ -60,7 +62,9 @@ namespace tfel::math::enzyme::internals {
       const TypeList<CallableArgumentType0, CallableArgumentType1>&,
       const CallableType& c,
       ArgumentType0&& arg0,
-      ArgumentType1&& arg1) {
+      ArgumentType1&& arg1)  //
+      requires(countNumberOfVariableValueAndIncrement<ArgumentType0,
+                                                      ArgumentType1>() < 2u) {
     checkCallEnzymeFwdDiffArguments(
         TypeList<CallableArgumentType0, CallableArgumentType1>{},
         TypeList<ArgumentType0, ArgumentType1>{});
@@ -100,7 +104,10 @@ namespace tfel::math::enzyme::internals {
                              const CallableType& c,
                              ArgumentType0&& arg0,
                              ArgumentType1&& arg1,
-                             ArgumentType2&& arg2) {
+                             ArgumentType2&& arg2)  //
+      requires(countNumberOfVariableValueAndIncrement<ArgumentType0,
+                                                      ArgumentType1,
+                                                      ArgumentType2>() < 2u) {
     checkCallEnzymeFwdDiffArguments(
         TypeList<CallableArgumentType0, CallableArgumentType1,
                  CallableArgumentType2>{},
@@ -159,7 +166,11 @@ namespace tfel::math::enzyme::internals {
                              ArgumentType0&& arg0,
                              ArgumentType1&& arg1,
                              ArgumentType2&& arg2,
-                             ArgumentType3&& arg3) {
+                             ArgumentType3&& arg3)  //
+      requires(countNumberOfVariableValueAndIncrement<ArgumentType0,
+                                                      ArgumentType1,
+                                                      ArgumentType2,
+                                                      ArgumentType3>() < 2u) {
     checkCallEnzymeFwdDiffArguments(
         TypeList<CallableArgumentType0, CallableArgumentType1,
                  CallableArgumentType2, CallableArgumentType3>{},
@@ -214,6 +225,92 @@ namespace tfel::math::enzyme::internals {
     }
   }
 
+  //! \return the positions of the arguments holding an increment
+  template <typename... ArgumentsTypes>
+  constexpr auto getVariableValueAndIncrementPositions() noexcept {
+    constexpr auto is_vdv = std::array<bool, sizeof...(ArgumentsTypes)>{
+        isVariableValueAndIncrement<ArgumentsTypes>()...};
+    auto positions = std::array<
+        std::size_t,
+        countNumberOfVariableValueAndIncrement<ArgumentsTypes...>()>{};
+    auto k = std::size_t{};
+    for (std::size_t i = 0; i != is_vdv.size(); ++i) {
+      if (is_vdv[i]) {
+        positions[k] = i;
+        ++k;
+      }
+    }
+    return positions;
+  }  // end of getVariableValueAndIncrementPositions
+
+  //! \return the value of an argument passed to `fwddiff`
+  template <typename ArgumentType>
+  const auto& getVariableValue(const ArgumentType& arg) noexcept {
+    if constexpr (isVariableValueAndIncrement<ArgumentType>()) {
+      return arg.value;
+    } else {
+      return arg;
+    }
+  }  // end of getVariableValue
+
+  /*!
+   * \brief compute the increment of a callable when several arguments are
+   * incremented. The incremented arguments are packed in a tuple, so that
+   * all the increments are carried by a single call to `__enzyme_fwddiff`.
+   * \param[in] c: callable
+   * \param[in] args: arguments
+   */
+  template <std::size_t... a,
+            typename CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto fwddiffActiveArgumentsImplementation(
+      const std::index_sequence<a...>&,
+      const TypeList<CallableArgumentsTypes...>&,
+      const CallableType& c,
+      const ArgumentsTypes&... args) {
+    static constexpr auto positions =
+        getVariableValueAndIncrementPositions<ArgumentsTypes...>();
+    using ArgumentsValuesType =
+        std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<positions[a], ArgumentsValuesType>...>;
+    using ResultType =
+        std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    const auto all = std::forward_as_tuple(args...);
+    const auto v = ArgumentsValuesType{getVariableValue(args)...};
+    const auto x = ActiveArgumentsType{std::get<positions[a]>(all).value...};
+    const auto dx =
+        ActiveArgumentsType{std::get<positions[a]>(all).increment...};
+    auto wrapper = [](const CallableType* const ptr,
+                      const ActiveArgumentsType* const wx,
+                      const ArgumentsValuesType* const wv) -> ResultType {
+      return callWithActiveArguments<positions[a]...>(
+          *ptr, TypeList<CallableArgumentsTypes...>{}, *wx, *wv,
+          std::make_index_sequence<sizeof...(CallableArgumentsTypes)>{});
+    };
+    void* const wrapper_ptr = reinterpret_cast<void*>(+wrapper);
+    const void* const c_ptr = reinterpret_cast<const void*>(&c);
+    return __enzyme_fwddiff<ResultType>(wrapper_ptr, enzyme_const, c_ptr,  //
+                                        enzyme_dup, &x, &dx,               //
+                                        enzyme_const, &v);
+  }  // end of fwddiffActiveArgumentsImplementation
+
+  template <typename CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto fwddiffImplementation(const TypeList<CallableArgumentsTypes...>& args_list,
+                             const CallableType& c,
+                             ArgumentsTypes&&... args)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (countNumberOfVariableValueAndIncrement<ArgumentsTypes...>() >
+                1u)) {
+    constexpr auto n = countNumberOfVariableValueAndIncrement<ArgumentsTypes...>();
+    return fwddiffActiveArgumentsImplementation(
+        std::make_index_sequence<n>{}, args_list, c, args...);
+  }  // end of fwddiffImplementation
+
 }  // namespace tfel::math::enzyme::internals
 
 namespace tfel::math::enzyme {
@@ -16,6 +16,7 @@
 
 #include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
 #include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+#include "TFEL/Math/Enzyme/ModeSelection.hxx"
 
 namespace tfel::math::enzyme {
 
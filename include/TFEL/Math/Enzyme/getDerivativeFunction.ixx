@@ -14,6 +14,8 @@
 #ifndef LIB_TFEL_MATH_ENZYME_GETDERIVATIVEFUNCTION_IXX
 #define LIB_TFEL_MATH_ENZYME_GETDERIVATIVEFUNCTION_IXX
 
+#include <array>
+
 #include "TFEL/Math/Enzyme/getForwardModeDerivativeFunction.hxx"
 #include "TFEL/Math/Enzyme/getReverseModeDerivativeFunction.hxx"
 
@@ -23,7 +25,18 @@ namespace tfel::math::enzyme {
             std::size_t... Ns,
             internals::EnzymeCallableConcept CallableType>
   auto getDerivativeFunction(const CallableType& c) {
-    if constexpr (m == Mode::FORWARD) {
+    // in automatic mode, the mode is selected using the first derivative.
+    // Note that the reverse mode computes the hessian of a scalar function
+    // by forward-over-reverse differentiation.
+    constexpr auto rm = [] {
+      if constexpr ((m == Mode::AUTO) && (sizeof...(Ns) > 0)) {
+        constexpr auto N = std::array<std::size_t, sizeof...(Ns)>{Ns...}[0];
+        return getAutomaticMode<CallableType, N>();
+      } else {
+        return m;
+      }
+    }();
+    if constexpr (rm == Mode::FORWARD) {
       return getForwardModeDerivativeFunction<Ns...>(c);
     } else {
       return getReverseModeDerivativeFunction<Ns...>(c);
@@ -32,7 +45,7 @@ namespace tfel::math::enzyme {
 
   template <std::size_t... Ns, internals::EnzymeCallableConcept CallableType>
   auto getDerivativeFunction(const CallableType& c) {
-    return getDerivativeFunction<Mode::REVERSE, Ns...>(c);
+    return getDerivativeFunction<Mode::AUTO, Ns...>(c);
   }  // end of getDerivativeFunction
 
 }  // end of namespace tfel::math::enzyme
@@ -65,7 +78,7 @@ namespace tfel::math::enzyme {
   template <std::size_t... idx,
             internals::IsFunctionPointerConcept auto F>
   auto getDerivativeFunction(internals::FunctionWrapper<F> f) {
-    return getDerivativeFunction<Mode::REVERSE, idx...>(f);
+    return getDerivativeFunction<Mode::AUTO, idx...>(f);
   }  // end of getDerivativeFunction
 
 }  // end of namespace tfel::math::enzyme
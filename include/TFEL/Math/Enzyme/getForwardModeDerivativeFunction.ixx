@@ -14,22 +14,41 @@
 #ifndef LIB_TFEL_MATH_ENZYME_GETFORWARDMODEDERIVATIVEFUNCTION_IXX
 #define LIB_TFEL_MATH_ENZYME_GETFORWARDMODEDERIVATIVEFUNCTION_IXX
 
+#include <array>
+
 namespace tfel::math::enzyme::internals {
 
-  template <std::size_t N,
+  /*!
+   * \tparam s: treatment of the symmetry of the derivative. The derivative
+   * of the gradient of a scalar function with respect to the same variable
+   * is a hessian, which is symmetrized to remove the rounding errors.
+   */
+  template <Symmetry s,
+            std::size_t N,
             std::size_t... Ns,
             internals::EnzymeCallableConcept CallableType,
-            typename CallableArgumentType0>
+            typename... CallableArgumentsTypes>
   auto getForwardModeDerivativeFunctionImplementation(
       const CallableType& c,
-      const TypeList<CallableArgumentType0> args_list) requires(N == 0) {
-    auto dc = [c](CallableArgumentType0 warg) {
-      return ::tfel::math::enzyme::computeForwardModeDerivative(c, warg);
+      const TypeList<CallableArgumentsTypes...> args_list)  //
+      requires(N < sizeof...(CallableArgumentsTypes)) {
+    auto dc = [c](CallableArgumentsTypes... wargs) {
+      return computeForwardModeDerivativeImplementation<s, N>(
+          c, TypeList<CallableArgumentsTypes...>{}, wargs...);
     };
     if constexpr (sizeof...(Ns) == 0) {
       return dc;
     } else {
-      return getForwardModeDerivativeFunctionImplementation<Ns...>(dc, args_list);
+      using ResultType =
+          std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+      constexpr auto next_index = std::array<std::size_t, sizeof...(Ns)>{Ns...}[0];
+      constexpr auto next_symmetry =
+          (ScalarConcept<ResultType> && (next_index == N))
+              ? Symmetry::SYMMETRIZE
+              : Symmetry::NONE;
+      return getForwardModeDerivativeFunctionImplementation<next_symmetry,
+                                                            Ns...>(dc,
+                                                                   args_list);
     }
   }  // end of getForwardModeDerivativeFunctionImplementation
 
@@ -40,7 +59,8 @@ namespace tfel::math::enzyme {
   template <std::size_t... Ns, internals::EnzymeCallableConcept CallableType>
   auto getForwardModeDerivativeFunction(const CallableType& c) requires(
       sizeof...(Ns) > 0) {
-    return internals::getForwardModeDerivativeFunctionImplementation<Ns...>(
+    return internals::getForwardModeDerivativeFunctionImplementation<
+        Symmetry::NONE, Ns...>(
         c, internals::getArgumentsList<CallableType>());
   }  // end of getForwardModeDerivativeFunction
 
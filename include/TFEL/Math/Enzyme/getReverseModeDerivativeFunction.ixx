@@ -14,8 +14,79 @@
 #ifndef LIB_TFEL_MATH_ENZYME_GETREVERSEMODEDERIVATIVEFUNCTION_IXX
 #define LIB_TFEL_MATH_ENZYME_GETREVERSEMODEDERIVATIVEFUNCTION_IXX
 
+#include <array>
+#include "TFEL/Math/Enzyme/computeValueAndDerivative.hxx"
+
 namespace tfel::math::enzyme::internals {
 
+  template <std::size_t N,
+            std::size_t... Ns,
+            internals::EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes>
+  auto getReverseModeDerivativeFunctionImplementation(
+      const CallableType&, const TypeList<CallableArgumentsTypes...>);
+
+  /*!
+   * \brief return true if the derivative with respect to the variable `N` of
+   * a callable, computed in reverse mode, shall be differentiated with
+   * respect to the same variable using the forward mode.
+   *
+   * This is the case when the callable returns a scalar, i.e. when the
+   * derivative is a gradient. The second derivative is then a hessian which
+   * is computed by forward-over-reverse differentiation: the reverse sweep
+   * computing the gradient is itself differentiated by Enzyme's vector
+   * forward mode, which requires one vector pass for all the columns of the
+   * hessian (up to `maximumVectorWidth` columns) rather than one nested
+   * reverse pass per row.
+   */
+  template <typename CallableType,
+            std::size_t N,
+            std::size_t... Ns,
+            typename... CallableArgumentsTypes>
+  constexpr bool useForwardOverReverseMode(
+      const TypeList<CallableArgumentsTypes...>&) noexcept {
+    if constexpr (sizeof...(Ns) == 0) {
+      return false;
+    } else {
+      constexpr auto next_index = std::get<0>(std::array{Ns...});
+      using CallableResultType =
+          std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+      return (N == next_index) && (ScalarConcept<CallableResultType>);
+    }
+  }  // end of useForwardOverReverseMode
+
+  /*!
+   * \brief differentiate the first derivative `dc` of a callable with respect
+   * to the variable `N` using the forward mode and pursue with the
+   * remaining indices.
+   *
+   * \tparam N: index of the variable
+   * \tparam N2: index of the variable (equal to N)
+   * \tparam Ns: remaining indices
+   */
+  template <std::size_t N,
+            std::size_t N2,
+            std::size_t... Ns,
+            internals::EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes>
+  auto getForwardOverReverseModeDerivativeFunctionImplementation(
+      const CallableType& dc,
+      const TypeList<CallableArgumentsTypes...> args_list) requires(N == N2) {
+    auto d2c = [dc](CallableArgumentsTypes... wargs) {
+      // the hessian is symmetrized to remove the rounding errors
+      return computeValueAndDerivativeImplementation<Mode::FORWARD, N,
+                                                     Symmetry::SYMMETRIZE>(
+                 dc, TypeList<CallableArgumentsTypes...>{}, wargs...)
+          .derivative;
+    };
+    if constexpr (sizeof...(Ns) == 0) {
+      return d2c;
+    } else {
+      return getReverseModeDerivativeFunctionImplementation<Ns...>(d2c,
+                                                                   args_list);
+    }
+  }  // end of getForwardOverReverseModeDerivativeFunctionImplementation
+
   template <std::size_t N,
             std::size_t... Ns,
             internals::EnzymeCallableConcept CallableType,
@@ -28,6 +99,11 @@ namespace tfel::math::enzyme::internals {
     };
     if constexpr (sizeof...(Ns) == 0) {
       return dc;
+    } else if constexpr (useForwardOverReverseMode<CallableType, N, Ns...>(
+                             args_list)) {
+      return getForwardOverReverseModeDerivativeFunctionImplementation<N,
+                                                                       Ns...>(
+          dc, args_list);
     } else {
       return getReverseModeDerivativeFunctionImplementation<Ns...>(dc, args_list);
     }
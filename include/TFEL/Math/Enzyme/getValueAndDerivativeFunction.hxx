@@ -0,0 +1,54 @@
+/*!
+ * \file   TFEL/Math/Enzyme/getValueAndDerivativeFunction.hxx
+ * \brief  This file declares the getValueAndDerivativeFunction function
+ * \author Thomas Helfer
+ * \date   05/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_GETVALUEANDDERIVATIVEFUNCTION_HXX
+#define LIB_TFEL_MATH_ENZYME_GETVALUEANDDERIVATIVEFUNCTION_HXX
+
+#include "TFEL/Math/Enzyme/computeValueAndDerivative.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \return a callable returning both the value of the given callable and
+   * its derivative with respect to the variable designated by `idx`.
+   * \tparam m: differentiation mode
+   * \tparam idx: index of the variable. This index can be omitted for
+   * callables of one variable.
+   * \param[in] c: callable
+   */
+  template <Mode m,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType>
+  auto getValueAndDerivativeFunction(const CallableType&) requires(
+      sizeof...(idx) <= 1);
+
+  //! \brief overload using the reverse mode
+  template <std::size_t... idx, internals::EnzymeCallableConcept CallableType>
+  auto getValueAndDerivativeFunction(const CallableType&) requires(
+      sizeof...(idx) <= 1);
+
+  template <Mode m,
+            std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F>
+  auto getValueAndDerivativeFunction(internals::FunctionWrapper<F>) requires(
+      sizeof...(idx) <= 1);
+
+  template <std::size_t... idx, internals::IsFunctionPointerConcept auto F>
+  auto getValueAndDerivativeFunction(internals::FunctionWrapper<F>) requires(
+      sizeof...(idx) <= 1);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/getValueAndDerivativeFunction.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_GETVALUEANDDERIVATIVEFUNCTION_HXX */
@@ -0,0 +1,77 @@
+/*!
+ * \file   TFEL/Math/Enzyme/getValueAndDerivativeFunction.ixx
+ * \brief  This file implements the getValueAndDerivativeFunction function
+ * \author Thomas Helfer
+ * \date   05/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_GETVALUEANDDERIVATIVEFUNCTION_IXX
+#define LIB_TFEL_MATH_ENZYME_GETVALUEANDDERIVATIVEFUNCTION_IXX
+
+namespace tfel::math::enzyme::internals {
+
+  template <Mode m,
+            std::size_t... idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes>
+  auto getValueAndDerivativeFunctionImplementation(
+      const CallableType& c, const TypeList<CallableArgumentsTypes...>) {
+    return [c](CallableArgumentsTypes... wargs) {
+      return ::tfel::math::enzyme::computeValueAndDerivative<m, idx...>(
+          c, wargs...);
+    };
+  }  // end of getValueAndDerivativeFunctionImplementation
+
+  template <Mode m,
+            std::size_t... idx,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes>
+  auto getValueAndDerivativeFunctionImplementation(
+      FunctionWrapper<F>, const TypeList<FunctionArgumentsTypes...>) {
+    auto c = [](const FunctionArgumentsTypes... wargs) { return F(wargs...); };
+    return ::tfel::math::enzyme::getValueAndDerivativeFunction<m, idx...>(c);
+  }  // end of getValueAndDerivativeFunctionImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <Mode m,
+            std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType>
+  auto getValueAndDerivativeFunction(const CallableType& c) requires(
+      sizeof...(idx) <= 1) {
+    return internals::getValueAndDerivativeFunctionImplementation<m, idx...>(
+        c, internals::getArgumentsList<CallableType>());
+  }  // end of getValueAndDerivativeFunction
+
+  template <std::size_t... idx, internals::EnzymeCallableConcept CallableType>
+  auto getValueAndDerivativeFunction(const CallableType& c) requires(
+      sizeof...(idx) <= 1) {
+    return getValueAndDerivativeFunction<Mode::AUTO, idx...>(c);
+  }  // end of getValueAndDerivativeFunction
+
+  template <Mode m,
+            std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F>
+  auto getValueAndDerivativeFunction(internals::FunctionWrapper<F> f) requires(
+      sizeof...(idx) <= 1) {
+    return internals::getValueAndDerivativeFunctionImplementation<m, idx...>(
+        f, internals::getArgumentsList<decltype(F)>());
+  }  // end of getValueAndDerivativeFunction
+
+  template <std::size_t... idx, internals::IsFunctionPointerConcept auto F>
+  auto getValueAndDerivativeFunction(internals::FunctionWrapper<F> f) requires(
+      sizeof...(idx) <= 1) {
+    return getValueAndDerivativeFunction<Mode::AUTO, idx...>(f);
+  }  // end of getValueAndDerivativeFunction
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_GETVALUEANDDERIVATIVEFUNCTION_IXX */
@@ -0,0 +1,89 @@
+/*!
+ * \file   TFEL/Math/Enzyme/implicitDerivative.hxx
+ * \brief  This file declares the implicitDerivative function
+ * \author Thomas Helfer
+ * \date   11/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_IMPLICITDERIVATIVE_HXX
+#define LIB_TFEL_MATH_ENZYME_IMPLICITDERIVATIVE_HXX
+
+#include <type_traits>
+#include "TFEL/Math/Enzyme/computeDerivative.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the derivative of the solution `y` of the non linear
+   * equation `R(y, x, args...) = 0` with respect to `x` using the implicit
+   * function theorem:
+   *
+   * \f[
+   * \frac{dy}{dx} = -\left(\frac{\partial R}{\partial y}\right)^{-1}
+   *                  \frac{\partial R}{\partial x}
+   * \f]
+   *
+   * Only the residual is differentiated, at the converged solution, so that
+   * the cost does not depend on the number of iterations of the solver
+   * which computed `y`. The partial derivatives of the residual are
+   * computed by a single call to `computeDerivative` using the automatic
+   * mode and the linear system is solved by `TinyMatrixSolve`, which throws
+   * an exception if the partial derivative with respect to `y` is singular.
+   *
+   * \tparam CallableType: type of the residual
+   * \tparam SolutionType: type of the solution
+   * \tparam ParameterType: type of the parameter
+   * \tparam ArgumentsTypes: types of the additional arguments
+   * \param[in] R: residual
+   * \param[in] y: converged solution
+   * \param[in] x: value of the parameter
+   * \param[in] args: additional arguments, held constant
+   * \return the derivative of the solution with respect to the parameter
+   */
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept SolutionType,
+            VariableConcept ParameterType,
+            typename... ArgumentsTypes>
+  derivative_type<SolutionType, ParameterType> implicitDerivative(
+      const CallableType&,
+      const SolutionType&,
+      const ParameterType&,
+      ArgumentsTypes&&...)  //
+      requires(std::is_invocable_v<CallableType,
+                                   const SolutionType&,
+                                   const ParameterType&,
+                                   ArgumentsTypes...>);
+  /*!
+   * \brief compute the derivative of the solution of the non linear
+   * equation defined by a free function with respect to a parameter.
+   * \tparam F: pointer to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] y: converged solution
+   * \param[in] x: value of the parameter
+   * \param[in] args: additional arguments, held constant
+   */
+  template <internals::IsFunctionPointerConcept auto F,
+            VariableConcept SolutionType,
+            VariableConcept ParameterType,
+            typename... ArgumentsTypes>
+  derivative_type<SolutionType, ParameterType> implicitDerivative(
+      internals::FunctionWrapper<F>,
+      const SolutionType&,
+      const ParameterType&,
+      ArgumentsTypes&&...)  //
+      requires(std::is_invocable_v<decltype(F),
+                                   const SolutionType&,
+                                   const ParameterType&,
+                                   ArgumentsTypes...>);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/implicitDerivative.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_IMPLICITDERIVATIVE_HXX */
@@ -0,0 +1,168 @@
+/*!
+ * \file   TFEL/Math/Enzyme/implicitDerivative.ixx
+ * \brief  This file implements the implicitDerivative function
+ * \author Thomas Helfer
+ * \date   11/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_IMPLICITDERIVATIVE_IXX
+#define LIB_TFEL_MATH_ENZYME_IMPLICITDERIVATIVE_IXX
+
+#include <utility>
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \return the component `(i, j)` of the derivative of a variable of size
+   * `N` with respect to a variable of size `M`, stripped from its unit.
+   */
+  template <std::size_t N, std::size_t M, typename DerivativeType>
+  constexpr auto getDerivativeComponentValue(const DerivativeType& d,
+                                             const std::size_t i,
+                                             const std::size_t j) noexcept {
+    using value_type = base_type<numeric_type<DerivativeType>>;
+    if constexpr (ScalarConcept<DerivativeType>) {
+      static_cast<void>(i);
+      static_cast<void>(j);
+      return convertShadowValue<value_type>(d);
+    } else {
+      using size_type = typename DerivativeType::size_type;
+      if constexpr (M == 1) {
+        static_cast<void>(j);
+        return convertShadowValue<value_type>(d[static_cast<size_type>(i)]);
+      } else if constexpr (N == 1) {
+        static_cast<void>(i);
+        return convertShadowValue<value_type>(d[static_cast<size_type>(j)]);
+      } else {
+        return convertShadowValue<value_type>(
+            d(static_cast<size_type>(i), static_cast<size_type>(j)));
+      }
+    }
+  }  // end of getDerivativeComponentValue
+
+  //! \brief set the component `(i, j)` of a derivative
+  template <std::size_t N,
+            std::size_t M,
+            typename DerivativeType,
+            typename ValueType>
+  constexpr void setDerivativeComponentValue(DerivativeType& d,
+                                             const std::size_t i,
+                                             const std::size_t j,
+                                             const ValueType& v) noexcept {
+    using value_type = numeric_type<DerivativeType>;
+    if constexpr (ScalarConcept<DerivativeType>) {
+      static_cast<void>(i);
+      static_cast<void>(j);
+      d = convertShadowValue<value_type>(v);
+    } else {
+      using size_type = typename DerivativeType::size_type;
+      if constexpr (M == 1) {
+        static_cast<void>(j);
+        d[static_cast<size_type>(i)] = convertShadowValue<value_type>(v);
+      } else if constexpr (N == 1) {
+        static_cast<void>(i);
+        d[static_cast<size_type>(j)] = convertShadowValue<value_type>(v);
+      } else {
+        d(static_cast<size_type>(i), static_cast<size_type>(j)) =
+            convertShadowValue<value_type>(v);
+      }
+    }
+  }  // end of setDerivativeComponentValue
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType,
+            VariableConcept SolutionType,
+            VariableConcept ParameterType,
+            typename... ArgumentsTypes>
+  derivative_type<SolutionType, ParameterType> implicitDerivative(
+      const CallableType& R,
+      const SolutionType& y,
+      const ParameterType& x,
+      ArgumentsTypes&&... args)  //
+      requires(std::is_invocable_v<CallableType,
+                                   const SolutionType&,
+                                   const ParameterType&,
+                                   ArgumentsTypes...>) {
+    using DerivativeType = derivative_type<SolutionType, ParameterType>;
+    using ResidualType =
+        std::invoke_result_t<CallableType, const SolutionType&,
+                             const ParameterType&, ArgumentsTypes...>;
+    constexpr auto N = internals::getVariableSize<SolutionType>();
+    constexpr auto M = internals::getVariableSize<ParameterType>();
+    static_assert(internals::getVariableSize<ResidualType>() == N,
+                  "the size of the residual does not match the size of the "
+                  "solution");
+    const auto [dR_dy, dR_dx] = computeDerivative<Mode::AUTO, 0, 1>(
+        R, y, x, std::forward<ArgumentsTypes>(args)...);
+    if constexpr (N == 1) {
+      // no linear system to be solved
+      auto r = DerivativeType{};
+      for (std::size_t j = 0; j != M; ++j) {
+        const auto J = internals::getDerivativeComponentValue<1, 1>(dR_dy, 0, 0);
+        const auto b = internals::getDerivativeComponentValue<1, M>(dR_dx, 0, j);
+        internals::setDerivativeComponentValue<1, M>(r, 0, j, -b / J);
+      }
+      return r;
+    } else {
+      using value_type = base_type<numeric_type<ResidualType>>;
+      constexpr auto n = static_cast<unsigned short>(N);
+      constexpr auto m = static_cast<unsigned short>(M);
+      auto J = tmatrix<n, n, value_type>{};
+      auto b = tmatrix<n, m, value_type>{};
+      for (std::size_t i = 0; i != N; ++i) {
+        for (std::size_t j = 0; j != N; ++j) {
+          J(static_cast<unsigned short>(i), static_cast<unsigned short>(j)) =
+              internals::getDerivativeComponentValue<N, N>(dR_dy, i, j);
+        }
+        for (std::size_t j = 0; j != M; ++j) {
+          b(static_cast<unsigned short>(i), static_cast<unsigned short>(j)) =
+              -internals::getDerivativeComponentValue<N, M>(dR_dx, i, j);
+        }
+      }
+      TinyMatrixSolve<n, value_type>::exe(J, b);
+      auto r = DerivativeType{};
+      for (std::size_t i = 0; i != N; ++i) {
+        for (std::size_t j = 0; j != M; ++j) {
+          internals::setDerivativeComponentValue<N, M>(
+              r, i, j,
+              b(static_cast<unsigned short>(i), static_cast<unsigned short>(j)));
+        }
+      }
+      return r;
+    }
+  }  // end of implicitDerivative
+
+  template <internals::IsFunctionPointerConcept auto F,
+            VariableConcept SolutionType,
+            VariableConcept ParameterType,
+            typename... ArgumentsTypes>
+  derivative_type<SolutionType, ParameterType> implicitDerivative(
+      internals::FunctionWrapper<F>,
+      const SolutionType& y,
+      const ParameterType& x,
+      ArgumentsTypes&&... args)  //
+      requires(std::is_invocable_v<decltype(F),
+                                   const SolutionType&,
+                                   const ParameterType&,
+                                   ArgumentsTypes...>) {
+    const auto R = [](const SolutionType& wy, const ParameterType& wx,
+                      const std::decay_t<ArgumentsTypes>&... wargs) {
+      return F(wy, wx, wargs...);
+    };
+    return implicitDerivative(R, y, x, std::forward<ArgumentsTypes>(args)...);
+  }  // end of implicitDerivative
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_IMPLICITDERIVATIVE_IXX */
@@ -0,0 +1,88 @@
+/*!
+ * \file   TFEL/Math/Enzyme/jvp.hxx
+ * \brief  This file declares the jvp function
+ * \author Thomas Helfer
+ * \date   10/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_JVP_HXX
+#define LIB_TFEL_MATH_ENZYME_JVP_HXX
+
+#include <tuple>
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the product of the jacobian of a callable of one variable
+   * by a direction, without building the jacobian.
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentType: type of the argument
+   * \tparam DirectionType: type of the direction
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] v: direction
+   * \return the increment of the callable in the given direction
+   */
+  template <internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto jvp(const CallableType&, const ArgumentType&, const DirectionType&)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>));
+  /*!
+   * \brief compute the product of the jacobian of a callable with respect
+   * to the variables designated by the indices `idx` by the given
+   * directions, the other arguments being held constant.
+   *
+   * All the directions are propagated by a single call to `fwddiff`.
+   *
+   * \tparam idx: indices of the variables. If no index is given, all the
+   * arguments are considered.
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: types of the arguments
+   * \tparam DirectionsTypes: types of the directions
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   * \param[in] directions: directions, in the order of the indices
+   * \return the increment of the callable in the given directions
+   */
+  template <std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes,
+            typename... DirectionsTypes>
+  auto jvp(const CallableType&,
+           const std::tuple<ArgumentsTypes...>&,
+           const DirectionsTypes&...)  //
+      requires(((sizeof...(idx) == sizeof...(DirectionsTypes)) ||
+                ((sizeof...(idx) == 0) &&
+                 (sizeof...(DirectionsTypes) == sizeof...(ArgumentsTypes)))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, const ArgumentsTypes&...>));
+  /*!
+   * \brief compute the product of the jacobian of a free function by the
+   * given directions.
+   * \tparam idx: indices of the variables
+   * \tparam F: pointer to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] args: arguments passed to the `jvp` function of a callable
+   */
+  template <std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto jvp(internals::FunctionWrapper<F>, ArgumentsTypes&&...)  //
+      requires(sizeof...(ArgumentsTypes) > 1);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/jvp.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_JVP_HXX */
@@ -0,0 +1,143 @@
+/*!
+ * \file   TFEL/Math/Enzyme/jvp.ixx
+ * \brief  This file implements the jvp function
+ * \author Thomas Helfer
+ * \date   10/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_JVP_IXX
+#define LIB_TFEL_MATH_ENZYME_JVP_IXX
+
+#include <utility>
+#include "TFEL/Math/Enzyme/Internals/ActiveArguments.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  /*!
+   * \brief compute the product of the jacobian of a callable with respect to
+   * the variables `idx` by the given directions.
+   *
+   * The active arguments are gathered in a tuple and the callable is turned
+   * into a callable of this tuple, so that the directions are propagated by
+   * a single call to `fwddiff` whatever the number of active arguments.
+   */
+  template <std::size_t... idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes,
+            typename... DirectionsTypes>
+  auto jvpImplementation(const CallableType& c,
+                         const TypeList<CallableArgumentsTypes...>& args_list,
+                         const std::tuple<ArgumentsTypes...>& args,
+                         const DirectionsTypes&... directions)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (sizeof...(idx) == sizeof...(DirectionsTypes))) {
+    using ArgumentsValuesType =
+        std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<idx, ArgumentsValuesType>...>;
+    checkRedundancy<sizeof...(ArgumentsTypes) - 1, idx...>();
+    const auto v = std::make_from_tuple<ArgumentsValuesType>(args);
+    const auto bc = bindInactiveArguments<idx...>(c, args_list, v);
+    const auto vdv = VariableValueAndIncrement<ActiveArgumentsType>{
+        .value = ActiveArgumentsType{std::get<idx>(v)...},
+        .increment = ActiveArgumentsType(
+            static_cast<std::tuple_element_t<idx, ArgumentsValuesType>>(
+                directions)...)};
+    return ::tfel::math::enzyme::fwddiff(bc, vdv);
+  }  // end of jvpImplementation
+
+  //! \brief compute the product of the jacobian of a callable of one
+  //! variable by a direction.
+  template <EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto jvpImplementation(const CallableType& c,
+                         const TypeList<CallableArgumentType>&,
+                         const ArgumentType& x,
+                         const DirectionType& v) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    return ::tfel::math::enzyme::fwddiff(c, make_vdv<VariableType>(x, v));
+  }  // end of jvpImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename DirectionType>
+  auto jvp(const CallableType& c, const ArgumentType& x, const DirectionType& v)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)) {
+    return internals::jvpImplementation(
+        c, internals::getArgumentsList<CallableType>(), x, v);
+  }  // end of jvp
+
+  template <std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes,
+            typename... DirectionsTypes>
+  auto jvp(const CallableType& c,
+           const std::tuple<ArgumentsTypes...>& args,
+           const DirectionsTypes&... directions)  //
+      requires(((sizeof...(idx) == sizeof...(DirectionsTypes)) ||
+                ((sizeof...(idx) == 0) &&
+                 (sizeof...(DirectionsTypes) == sizeof...(ArgumentsTypes)))) &&
+               ((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, const ArgumentsTypes&...>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      return [&c, &args, &directions...]<std::size_t... i>(
+          const std::index_sequence<i...>&) {
+        return internals::jvpImplementation<i...>(
+            c, internals::getArgumentsList<CallableType>(), args,
+            directions...);
+      }
+      (std::index_sequence_for<ArgumentsTypes...>{});
+    } else {
+      return internals::jvpImplementation<idx...>(
+          c, internals::getArgumentsList<CallableType>(), args, directions...);
+    }
+  }  // end of jvp
+
+}  // end of namespace tfel::math::enzyme
+
+namespace tfel::math::enzyme::internals {
+
+  template <std::size_t... idx,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto jvpImplementation(FunctionWrapper<F>,
+                         const TypeList<FunctionArgumentsTypes...>,
+                         ArgumentsTypes&&... args) {
+    auto c = [](const FunctionArgumentsTypes... wargs) { return F(wargs...); };
+    return ::tfel::math::enzyme::jvp<idx...>(
+        c, std::forward<ArgumentsTypes>(args)...);
+  }  // end of jvpImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto jvp(internals::FunctionWrapper<F> f, ArgumentsTypes&&... args)  //
+      requires(sizeof...(ArgumentsTypes) > 1) {
+    return internals::jvpImplementation<idx...>(
+        f, internals::getArgumentsList<decltype(F)>(),
+        std::forward<ArgumentsTypes>(args)...);
+  }  // end of jvp
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_JVP_IXX */
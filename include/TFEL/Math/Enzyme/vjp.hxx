@@ -0,0 +1,100 @@
+/*!
+ * \file   TFEL/Math/Enzyme/vjp.hxx
+ * \brief  This file declares the vjp function
+ * \author Thomas Helfer
+ * \date   10/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_VJP_HXX
+#define LIB_TFEL_MATH_ENZYME_VJP_HXX
+
+#include <tuple>
+#include <cstddef>
+#include <type_traits>
+#include "TFEL/Math/Enzyme/Variable.hxx"
+#include "TFEL/Math/Enzyme/PackedDerivatives.hxx"
+#include "TFEL/Math/Enzyme/Internals/Enzyme.hxx"
+#include "TFEL/Math/Enzyme/Internals/FunctionUtilities.hxx"
+
+namespace tfel::math::enzyme {
+
+  /*!
+   * \brief compute the product of a cotangent by the jacobian of a callable
+   * of one variable, without building the jacobian. The cotangent is used as
+   * the seed of a single reverse pass.
+   *
+   * The cotangent has the type of the result of the callable, but its
+   * components are considered as dimensionless weights: the result has the
+   * type of the derivative of a component of the result of the callable
+   * with respect to the variable.
+   *
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentType: type of the argument
+   * \tparam CotangentType: type of the cotangent
+   * \param[in] c: callable
+   * \param[in] x: value of the variable
+   * \param[in] w: cotangent
+   */
+  template <internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename CotangentType>
+  auto vjp(const CallableType&, const ArgumentType&, const CotangentType&)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)&&(
+                   VariableConcept<std::invoke_result_t<CallableType,
+                                                        const ArgumentType&>>));
+  /*!
+   * \brief compute the product of a cotangent by the jacobian of a callable
+   * with respect to the variables designated by the indices `idx`, the other
+   * arguments being held constant. The cotangent is used as the seed of a
+   * single reverse pass.
+   *
+   * \tparam idx: indices of the variables. If no index is given, all the
+   * arguments are considered.
+   * \tparam CallableType: type of the callable
+   * \tparam ArgumentsTypes: types of the arguments
+   * \tparam CotangentType: type of the cotangent
+   * \param[in] c: callable
+   * \param[in] args: arguments passed to the callable
+   * \param[in] w: cotangent
+   * \return the product with respect to the selected argument if only one
+   * argument is selected, and `PackedDerivatives` object holding the products
+   * in the order of the indices `idx` otherwise.
+   */
+  template <std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes,
+            typename CotangentType>
+  auto vjp(const CallableType&,
+           const std::tuple<ArgumentsTypes...>&,
+           const CotangentType&)  //
+      requires(((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, const ArgumentsTypes&...>)&&(
+                   VariableConcept<std::invoke_result_t<
+                       CallableType,
+                       const ArgumentsTypes&...>>));
+  /*!
+   * \brief compute the product of a cotangent by the jacobian of a free
+   * function.
+   * \tparam idx: indices of the variables
+   * \tparam F: pointer to the free function
+   * \param[in] f: free function wrapper
+   * \param[in] args: arguments passed to the `vjp` function of a callable
+   */
+  template <std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto vjp(internals::FunctionWrapper<F>, ArgumentsTypes&&...)  //
+      requires(sizeof...(ArgumentsTypes) > 1);
+
+}  // end of namespace tfel::math::enzyme
+
+#include "TFEL/Math/Enzyme/vjp.ixx"
+
+#endif /* LIB_TFEL_MATH_ENZYME_VJP_HXX */
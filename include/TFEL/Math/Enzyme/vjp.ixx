@@ -0,0 +1,175 @@
+/*!
+ * \file   TFEL/Math/Enzyme/vjp.ixx
+ * \brief  This file implements the vjp function
+ * \author Thomas Helfer
+ * \date   10/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_ENZYME_VJP_IXX
+#define LIB_TFEL_MATH_ENZYME_VJP_IXX
+
+#include <array>
+#include <utility>
+#include "TFEL/Math/General/DerivativeType.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/Internals/ActiveArguments.hxx"
+
+namespace tfel::math::enzyme::internals {
+
+  //! \brief type of the product of a cotangent by a jacobian
+  template <typename ResultType, typename VariableType>
+  using CotangentProductType =
+      derivative_type<numeric_type<ResultType>, VariableType>;
+
+  /*!
+   * \brief compute the product of a cotangent by the jacobian of a callable
+   * of one variable.
+   */
+  template <EnzymeCallableConcept CallableType,
+            typename CallableArgumentType,
+            typename ArgumentType,
+            typename CotangentType>
+  auto vjpImplementation(const CallableType& c,
+                         const TypeList<CallableArgumentType>&,
+                         const ArgumentType& arg,
+                         const CotangentType& w) {
+    using VariableType = std::decay_t<CallableArgumentType>;
+    using ResultType =
+        std::invoke_result_t<CallableType, CallableArgumentType>;
+    const auto x = static_cast<VariableType>(arg);
+    auto r = ResultType{};
+    auto dr = std::array<ResultType, 1>{static_cast<ResultType>(w)};
+    auto dx = std::array<VariableType, 1>{};
+    computeVectorReverseModeGradients(r, dx.data(), c, x, dr.data(),
+                                      std::make_index_sequence<1>{});
+    return convertShadow<CotangentProductType<ResultType, VariableType>>(
+        dx[0]);
+  }  // end of vjpImplementation
+
+  /*!
+   * \brief compute the product of a cotangent by the jacobian of a callable
+   * with respect to the variables `idx`.
+   *
+   * The active arguments are gathered in a tuple and the callable is turned
+   * into a callable of this tuple, so that all the products are computed by
+   * a single reverse pass whatever the number of active arguments.
+   */
+  template <std::size_t... idx,
+            EnzymeCallableConcept CallableType,
+            typename... CallableArgumentsTypes,
+            typename... ArgumentsTypes,
+            typename CotangentType>
+  auto vjpImplementation(const CallableType& c,
+                         const TypeList<CallableArgumentsTypes...>& args_list,
+                         const std::tuple<ArgumentsTypes...>& args,
+                         const CotangentType& w)  //
+      requires((sizeof...(CallableArgumentsTypes) ==
+                sizeof...(ArgumentsTypes)) &&
+               (sizeof...(idx) > 0)) {
+    using ResultType =
+        std::invoke_result_t<CallableType, CallableArgumentsTypes...>;
+    using ArgumentsValuesType =
+        std::tuple<std::decay_t<CallableArgumentsTypes>...>;
+    using ActiveArgumentsType =
+        std::tuple<std::tuple_element_t<idx, ArgumentsValuesType>...>;
+    checkRedundancy<sizeof...(ArgumentsTypes) - 1, idx...>();
+    const auto v = std::make_from_tuple<ArgumentsValuesType>(args);
+    const auto x = ActiveArgumentsType{std::get<idx>(v)...};
+    const auto bc = bindInactiveArguments<idx...>(c, args_list, v);
+    auto r = ResultType{};
+    auto dr = std::array<ResultType, 1>{static_cast<ResultType>(w)};
+    auto dx = std::array<ActiveArgumentsType, 1>{};
+    computeVectorReverseModeGradients(r, dx.data(), bc, x, dr.data(),
+                                      std::make_index_sequence<1>{});
+    if constexpr (sizeof...(idx) == 1) {
+      using ProductType = CotangentProductType<
+          ResultType, std::tuple_element_t<0, ActiveArgumentsType>>;
+      return convertShadow<ProductType>(std::get<0>(dx[0]));
+    } else {
+      auto p = PackedDerivatives<CotangentProductType<
+          ResultType, std::tuple_element_t<idx, ArgumentsValuesType>>...>{};
+      convertShadows(p, dx[0], std::make_index_sequence<sizeof...(idx)>{});
+      return p;
+    }
+  }  // end of vjpImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <internals::EnzymeCallableConcept CallableType,
+            typename ArgumentType,
+            typename CotangentType>
+  auto vjp(const CallableType& c, const ArgumentType& x, const CotangentType& w)  //
+      requires((internals::getArgumentsSize<CallableType>() == 1u) &&
+               (std::is_invocable_v<CallableType, const ArgumentType&>)&&(
+                   VariableConcept<std::invoke_result_t<CallableType,
+                                                        const ArgumentType&>>)) {
+    return internals::vjpImplementation(
+        c, internals::getArgumentsList<CallableType>(), x, w);
+  }  // end of vjp
+
+  template <std::size_t... idx,
+            internals::EnzymeCallableConcept CallableType,
+            typename... ArgumentsTypes,
+            typename CotangentType>
+  auto vjp(const CallableType& c,
+           const std::tuple<ArgumentsTypes...>& args,
+           const CotangentType& w)  //
+      requires(((idx < sizeof...(ArgumentsTypes)) && ...) &&
+               (std::is_invocable_v<CallableType, const ArgumentsTypes&...>)&&(
+                   VariableConcept<std::invoke_result_t<
+                       CallableType,
+                       const ArgumentsTypes&...>>)) {
+    if constexpr (sizeof...(idx) == 0) {
+      return [&c, &args, &w ]<std::size_t... i>(
+          const std::index_sequence<i...>&) {
+        return internals::vjpImplementation<i...>(
+            c, internals::getArgumentsList<CallableType>(), args, w);
+      }
+      (std::index_sequence_for<ArgumentsTypes...>{});
+    } else {
+      return internals::vjpImplementation<idx...>(
+          c, internals::getArgumentsList<CallableType>(), args, w);
+    }
+  }  // end of vjp
+
+}  // end of namespace tfel::math::enzyme
+
+namespace tfel::math::enzyme::internals {
+
+  template <std::size_t... idx,
+            IsFunctionPointerConcept auto F,
+            typename... FunctionArgumentsTypes,
+            typename... ArgumentsTypes>
+  auto vjpImplementation(FunctionWrapper<F>,
+                         const TypeList<FunctionArgumentsTypes...>,
+                         ArgumentsTypes&&... args) {
+    auto c = [](const FunctionArgumentsTypes... wargs) { return F(wargs...); };
+    return ::tfel::math::enzyme::vjp<idx...>(
+        c, std::forward<ArgumentsTypes>(args)...);
+  }  // end of vjpImplementation
+
+}  // end of namespace tfel::math::enzyme::internals
+
+namespace tfel::math::enzyme {
+
+  template <std::size_t... idx,
+            internals::IsFunctionPointerConcept auto F,
+            typename... ArgumentsTypes>
+  auto vjp(internals::FunctionWrapper<F> f, ArgumentsTypes&&... args)  //
+      requires(sizeof...(ArgumentsTypes) > 1) {
+    return internals::vjpImplementation<idx...>(
+        f, internals::getArgumentsList<decltype(F)>(),
+        std::forward<ArgumentsTypes>(args)...);
+  }  // end of vjp
+
+}  // end of namespace tfel::math::enzyme
+
+#endif /* LIB_TFEL_MATH_ENZYME_VJP_IXX */
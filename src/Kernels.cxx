@@ -0,0 +1,39 @@
+/*!
+ * \file   src/Kernels.cxx
+ * \brief  This file defines the derivative kernels of the
+ * `TFELMathEnzymeKernels` library
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ * \copyright Copyright (C) 2006-2024 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "TFEL/Math/Enzyme/DefineDerivativeKernel.hxx"
+#include "TFEL/Math/Enzyme/Kernels.hxx"
+
+namespace tfel::math::enzyme::kernels {
+
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+                                            computeVonMisesStress<1u>,
+                                            1)
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+                                            computeVonMisesStress<2u>,
+                                            1)
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeVonMisesNormal,
+                                            computeVonMisesStress<3u>,
+                                            1)
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeVonMisesNormalDerivative,
+                                            computeVonMisesStress<1u>,
+                                            2)
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeVonMisesNormalDerivative,
+                                            computeVonMisesStress<2u>,
+                                            2)
+  TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeVonMisesNormalDerivative,
+                                            computeVonMisesStress<3u>,
+                                            2)
+
+}  // end of namespace tfel::math::enzyme::kernels
@@ -0,0 +1,145 @@
+/*!
+ * \file   tests/ActiveCallable.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ */
+
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/Enzyme/ActiveCallable.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+//! \brief Hooke potential with public material parameters
+struct HookePotential {
+  double lambda;
+  double mu;
+  double operator()(const tfel::math::stensor<3u, double>& e) const {
+    using namespace tfel::math;
+    return (this->lambda / 2) * power<2>(trace(e)) + this->mu * (e | e);
+  }
+};
+
+//! \brief Hooke law with public material parameters
+struct HookeLaw {
+  double lambda;
+  double mu;
+  tfel::math::stensor<3u, double> operator()(
+      const tfel::math::stensor<3u, double>& e) const {
+    using namespace tfel::math;
+    using Stensor = stensor<3u, double>;
+    return this->lambda * trace(e) * Stensor::Id() + 2 * this->mu * e;
+  }
+};
+
+struct TFELMathEnzymeActiveCallable final : public tfel::tests::TestCase {
+  TFELMathEnzymeActiveCallable()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeActiveCallable") {
+  }  // end of TFELMathEnzymeActiveCallable
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    using Stensor = stensor<3u, double>;
+    const auto w = HookePotential{.lambda = 150e9, .mu = 70e9};
+    const auto e = Stensor{1e-3, 2e-3, 0, 1e-3, 0, 0};
+    const auto [sig, dw] = computeReverseModeDerivative(active(w), e);
+    const Stensor sig_ref =
+        w.lambda * trace(e) * Stensor::Id() + 2 * w.mu * e;
+    TFEL_TESTS_ASSERT(abs(sig - sig_ref) < w.lambda * eps);
+    TFEL_TESTS_ASSERT(std::abs(dw.lambda - power<2>(trace(e)) / 2) < eps);
+    TFEL_TESTS_ASSERT(std::abs(dw.mu - (e | e)) < eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    // parameters captured by value by a lambda function
+    const auto a = double{2};
+    const auto c = [a](const double x, const double y) {
+      return a * x * power<2>(y);
+    };
+    // the closure holds a single double, the captured value, whose
+    // derivative is x * y * y
+    static_assert(sizeof(c) == sizeof(double));
+    const auto [d, dc] = computeReverseModeDerivative<1>(active(c), 3., 4.);
+    TFEL_TESTS_ASSERT(std::abs(d - 48) < eps);
+    TFEL_TESTS_ASSERT(std::abs(std::bit_cast<double>(dc) - 48) < eps);
+    const auto [dxy, dc2] = computeReverseModeDerivative(active(c), 3., 4.);
+    TFEL_TESTS_ASSERT(std::abs(get<0>(dxy) - 32) < eps);
+    TFEL_TESTS_ASSERT(std::abs(get<1>(dxy) - 48) < eps);
+    TFEL_TESTS_ASSERT(std::abs(std::bit_cast<double>(dc2) - 48) < eps);
+  }
+  // callable returning a math object
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto h = HookeLaw{.lambda = 150e9, .mu = 70e9};
+    const auto e = Stensor{1e-3, 2e-3, 0, 1e-3, 0, 0};
+    const auto [K, dsig] = computeReverseModeDerivative(active(h), e);
+    const Stensor4 K_ref = h.lambda * Stensor4::IxI() + 2 * h.mu * Stensor4::Id();
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < h.lambda * eps);
+    // derivatives of the stress with respect to the material parameters
+    TFEL_TESTS_ASSERT(dsig.size() == 6);
+    const Stensor dsig_dlambda = trace(e) * Stensor::Id();
+    const Stensor dsig_dmu = 2 * e;
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(dsig[i].lambda - dsig_dlambda(i)) < eps);
+      TFEL_TESTS_ASSERT(std::abs(dsig[i].mu - dsig_dmu(i)) < eps);
+    }
+  }
+  // derivative of the stress with respect to the young modulus captured by
+  // a lambda function
+  void test4() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    using Stensor = stensor<3u, double>;
+    const auto E = double{150e9};
+    const auto c = [E](const Stensor& e, const double a) -> Stensor {
+      return a * E * e;
+    };
+    static_assert(sizeof(c) == sizeof(double));
+    const auto e = Stensor{1e-3, 2e-3, 0, 1e-3, 0, 0};
+    const auto a = double{2};
+    const auto [dsig_da, dsig] =
+        computeReverseModeDerivative<1>(active(c), e, a);
+    TFEL_TESTS_ASSERT(abs(dsig_da - E * e) < E * eps);
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(std::bit_cast<double>(dsig[i]) - a * e(i)) <
+                        eps);
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeActiveCallable,
+                          "TFELMathEnzymeActiveCallable");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-ActiveCallable.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,119 @@
+/*!
+ * \file   tests/DerivativeKernel.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ */
+
+#include <cmath>
+#include <limits>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/DefineDerivativeKernel.hxx"
+#include "TFEL/Math/Enzyme/Kernels.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+using Stensor = tfel::math::stensor<3u, double>;
+
+static tfel::math::qt<tfel::math::Stress, double> computeFreeEnergy(
+    const tfel::math::qt<tfel::math::NoUnit, double> e) {
+  constexpr auto E = tfel::math::qt<tfel::math::Stress, double>{150e9};
+  return E * e * e / 2;
+}
+
+static Stensor computeStress(const Stensor& e) {
+  using namespace tfel::material;
+  constexpr auto lambda = computeLambda(double{70e9}, double{0.3});
+  constexpr auto mu = computeMu(double{70e9}, double{0.3});
+  return lambda * trace(e) * Stensor::Id() + 2 * mu * e;
+}
+
+// kernels are usually declared in a header and defined in a library
+TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeFreeEnergyDerivative,
+                                           computeFreeEnergy,
+                                           1);
+TFEL_MATH_ENZYME_DECLARE_DERIVATIVE_KERNEL(computeStiffness, computeStress, 1);
+
+TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL(computeFreeEnergyDerivative,
+                                          computeFreeEnergy,
+                                          1)
+TFEL_MATH_ENZYME_DEFINE_DERIVATIVE_KERNEL_WITH_MODE(
+    computeStiffness, computeStress, 1, tfel::math::enzyme::Mode::FORWARD)
+
+struct TFELMathEnzymeDerivativeKernel final : public tfel::tests::TestCase {
+  TFELMathEnzymeDerivativeKernel()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeDerivativeKernel") {
+  }  // end of TFELMathEnzymeDerivativeKernel
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math;
+    constexpr auto eps = double{1e-14};
+    constexpr auto E = qt<Stress, double>{150e9};
+    const auto e = qt<NoUnit, double>{1e-3};
+    const auto s = computeFreeEnergyDerivative(e);
+    TFEL_TESTS_ASSERT(std::abs((s - E * e).getValue()) < E.getValue() * eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::material;
+    using Stensor4 = st2tost2<3u, double>;
+    constexpr auto E = double{70e9};
+    constexpr auto eps = double{1e-14};
+    constexpr auto lambda = computeLambda(E, double{0.3});
+    constexpr auto mu = computeMu(E, double{0.3});
+    const Stensor4 K = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    TFEL_TESTS_ASSERT(abs(computeStiffness(e) - K) < E * eps);
+  }
+  // precompiled kernels
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme::kernels;
+    using Stensor4 = st2tost2<3u, double>;
+    constexpr auto eps = double{1e-14};
+    const auto s = Stensor{100, 20, -30, 40, 0, 0};
+    const auto seq = sigmaeq(s);
+    const auto n = computeVonMisesNormal(s);
+    const Stensor n_ref = 3 * deviator(s) / (2 * seq);
+    TFEL_TESTS_ASSERT(abs(n - n_ref) < eps);
+    // closed form of the derivative of the normal, where K is the
+    // deviatoric projector
+    const auto dn = computeVonMisesNormalDerivative(s);
+    const Stensor4 dn_ref = (3 * Stensor4::K() / 2 - (n_ref ^ n_ref)) / seq;
+    // the components of the derivative scale as 1 / seq
+    const auto deps = 10 * std::numeric_limits<double>::epsilon() / seq;
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(dn(i, j) - dn_ref(i, j)) < deps);
+      }
+    }
+    // the normal is homogeneous of degree 0, so its derivative vanishes in
+    // the direction of the stress
+    TFEL_TESTS_ASSERT(abs(dn * s) < 100 * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeDerivativeKernel,
+                          "TFELMathEnzymeDerivativeKernel");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-DerivativeKernel.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
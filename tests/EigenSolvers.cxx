@@ -0,0 +1,133 @@
+/*!
+ * \file   tests/EigenSolvers.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ */
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Math/Enzyme/EigenSolvers.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeReverseModeDerivative.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+struct TFELMathEnzymeEigenSolvers final : public tfel::tests::TestCase {
+  TFELMathEnzymeEigenSolvers()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeEigenSolvers") {
+  }  // end of TFELMathEnzymeEigenSolvers
+  tfel::tests::TestResult execute() override {
+    using Stensor = tfel::math::stensor<3u, double>;
+    this->test1<Stensor::TFELEIGENSOLVER>();
+    this->test1<Stensor::FSESJACOBIEIGENSOLVER>();
+    this->test2<Stensor::TFELEIGENSOLVER>();
+    this->test2<Stensor::FSESJACOBIEIGENSOLVER>();
+    this->test3<Stensor::TFELEIGENSOLVER>();
+    this->test3<Stensor::FSESJACOBIEIGENSOLVER>();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief derivative of the eigen values of a diagonal tensor
+  template <tfel::math::stensor_common::EigenSolver esolver>
+  void test1() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto s = Stensor{0, 1, 2, 0, 0, 0};
+    const auto [vp, m] = s.computeEigenVectors<esolver>();
+    const auto [n0, n1, n2] = Stensor::computeEigenTensors(m);
+    const auto n = std::array<Stensor, 3u>{n0, n1, n2};
+    const auto vp2 = tfel::math::enzyme::computeEigenValues<esolver>(s);
+    for (unsigned short i = 0; i != 3; ++i) {
+      const auto eigen_value = [i](const Stensor& v) -> double {
+        return tfel::math::enzyme::computeEigenValues<esolver>(v)(i);
+      };
+      TFEL_TESTS_ASSERT(std::abs(vp2(i) - vp(i)) < eps);
+      // the eigen values are the diagonal components, so the derivative of
+      // an eigen value is the projector on the associated axis
+      auto dvp_ref = Stensor(double{0});
+      for (unsigned short k = 0; k != 3; ++k) {
+        if (std::abs(s(k) - vp(i)) < eps) {
+          dvp_ref(k) = 1;
+        }
+      }
+      TFEL_TESTS_ASSERT(abs(n[i] - dvp_ref) < eps);
+      const auto dvp_fwd = computeForwardModeDerivative(eigen_value, s);
+      const auto dvp_rev = computeReverseModeDerivative(eigen_value, s);
+      TFEL_TESTS_ASSERT(abs(dvp_fwd - dvp_ref) < eps);
+      TFEL_TESTS_ASSERT(abs(dvp_rev - dvp_ref) < eps);
+    }
+  }
+  //! \brief derivative of the eigen tensors
+  template <tfel::math::stensor_common::EigenSolver esolver>
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto s = Stensor{0, 1, 2, 0.5, 0, 0};
+    const auto first_eigen_tensor = [](const Stensor& v) -> Stensor {
+      return tfel::math::enzyme::computeEigenTensors<esolver>(v)[0];
+    };
+    const auto [vp, m] = s.computeEigenVectors<esolver>();
+    auto dn0 = Stensor4{};
+    auto dn1 = Stensor4{};
+    auto dn2 = Stensor4{};
+    Stensor::computeEigenTensorsDerivatives(dn0, dn1, dn2, vp, m, 1e-14);
+    const auto dn0_fwd = computeForwardModeDerivative(first_eigen_tensor, s);
+    const auto dn0_rev = computeReverseModeDerivative(first_eigen_tensor, s);
+    TFEL_TESTS_ASSERT(abs(dn0_fwd - dn0) < eps);
+    TFEL_TESTS_ASSERT(abs(dn0_rev - dn0) < eps);
+  }
+  //! \brief comparison of the derivative of the eigen values to centered
+  //! finite differences
+  template <tfel::math::stensor_common::EigenSolver esolver>
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    // perturbation and tolerance of the finite differences
+    constexpr auto h = double{1e-6};
+    constexpr auto eps = double{1e-7};
+    using Stensor = stensor<3u, double>;
+    const auto s = Stensor{0, 1, 2, 0.5, 0.3, 0};
+    for (unsigned short i = 0; i != 3; ++i) {
+      const auto eigen_value = [i](const Stensor& v) -> double {
+        return tfel::math::enzyme::computeEigenValues<esolver>(v)(i);
+      };
+      const auto dvp_fwd = computeForwardModeDerivative(eigen_value, s);
+      const auto dvp_rev = computeReverseModeDerivative(eigen_value, s);
+      for (unsigned short k = 0; k != 6; ++k) {
+        auto sp = s;
+        auto sm = s;
+        sp(k) += h;
+        sm(k) -= h;
+        const auto dvp_fd = (eigen_value(sp) - eigen_value(sm)) / (2 * h);
+        TFEL_TESTS_ASSERT(std::abs(dvp_fwd(k) - dvp_fd) < eps);
+        TFEL_TESTS_ASSERT(std::abs(dvp_rev(k) - dvp_fd) < eps);
+      }
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeEigenSolvers,
+                          "TFELMathEnzymeEigenSolvers");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-EigenSolvers.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
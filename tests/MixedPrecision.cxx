@@ -0,0 +1,204 @@
+/*!
+ * \file   tests/MixedPrecision.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   14/08/2025
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/fwddiff.hxx"
+#include "TFEL/Math/Enzyme/computeDerivative.hxx"
+#include "TFEL/Math/Enzyme/getDerivativeFunction.hxx"
+#include "TFEL/Math/Enzyme/MixedPrecision.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double potential(const tfel::math::stensor<3u, double>& e,
+                        const double a) {
+  return a * (e | e);
+}
+
+struct TFELMathEnzymeMixedPrecision final : public tfel::tests::TestCase {
+  TFELMathEnzymeMixedPrecision()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeMixedPrecision") {
+  }  // end of TFELMathEnzymeMixedPrecision
+  tfel::tests::TestResult execute() override {
+    using tfel::math::enzyme::Mode;
+    this->test1<Mode::FORWARD>();
+    this->test1<Mode::REVERSE>();
+    this->test2<Mode::FORWARD>();
+    this->test2<Mode::REVERSE>();
+    this->test3<Mode::FORWARD>();
+    this->test3<Mode::REVERSE>();
+    this->test4<Mode::FORWARD>();
+    this->test4<Mode::REVERSE>();
+    this->test5<Mode::FORWARD>();
+    this->test5<Mode::REVERSE>();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief machine epsilon in single precision
+  static constexpr auto feps = std::numeric_limits<float>::epsilon();
+  // number of points which is not a multiple of the size of the blocks
+  static constexpr std::size_t npoints = 11;
+  //! \return if `v` is the value `v_ref` rounded to single precision
+  static bool isRounded(const float v, const double v_ref) {
+    return std::abs(static_cast<double>(v) - v_ref) <=
+           std::abs(v_ref) * static_cast<double>(feps);
+  }
+  // single precision scalar functions
+  template <tfel::math::enzyme::Mode m>
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = 4 * feps;
+    const auto c = [](const float x) { return std::cos(x); };
+    const auto x = float{1};
+    TFEL_TESTS_ASSERT(std::abs(fwddiff(c, make_vdv<float>(x, 1)) +
+                               std::sin(x)) < eps);
+    const auto dc = computeDerivative<m, 0>(c, x);
+    TFEL_TESTS_STATIC_ASSERT((std::is_same_v<decltype(dc), const float>));
+    TFEL_TESTS_ASSERT(std::abs(dc + std::sin(x)) < eps);
+    const auto d2c = getDerivativeFunction<m, 0, 0>(c);
+    TFEL_TESTS_ASSERT(std::abs(d2c(x) + std::cos(x)) < eps);
+  }
+  // single precision quantities and math objects
+  template <tfel::math::enzyme::Mode m>
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto eps = 4 * feps;
+    const auto E = qt<Stress, float>{150e9};
+    const auto Phi = [E](const qt<NoUnit, float> e) { return E * e * e / 2; };
+    const auto stress = getDerivativeFunction<m, 0>(Phi);
+    const auto e = qt<NoUnit, float>{1e-2};
+    const auto s = stress(e);
+    TFEL_TESTS_STATIC_ASSERT(
+        (std::is_same_v<decltype(s), const qt<Stress, float>>));
+    TFEL_TESTS_ASSERT(abs(s - E * e) < E * e * eps);
+    // hooke law
+    constexpr auto E2 = float{70e9};
+    constexpr auto nu = float{0.3};
+    constexpr auto lambda = computeLambda(E2, nu);
+    constexpr auto mu = computeMu(E2, nu);
+    using Stensor = stensor<3u, float>;
+    using Stensor4 = st2tost2<3u, float>;
+    const auto hooke_stress = [](const Stensor& v) -> Stensor {
+      return lambda * trace(v) * Stensor::Id() + 2 * mu * v;
+    };
+    const auto K = computeDerivative<m, 0>(hooke_stress,
+                                           Stensor{0.01, 0.02, 0, 0.03, 0, 0});
+    TFEL_TESTS_STATIC_ASSERT((std::is_same_v<decltype(K), const Stensor4>));
+    const auto K_ref = Stensor4{lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id()};
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(K(i, j) - K_ref(i, j)) <= E2 * eps);
+      }
+    }
+  }
+  // the callable is evaluated in double precision, the derivative is stored
+  // in single precision
+  template <tfel::math::enzyme::Mode m>
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    using Stensor = stensor<3u, double>;
+    const auto hooke_stress = [](const Stensor& v) -> Stensor {
+      return lambda * trace(v) * Stensor::Id() + 2 * mu * v;
+    };
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto K = computeMixedPrecisionDerivative<m, float>(hooke_stress, e);
+    TFEL_TESTS_STATIC_ASSERT(
+        (std::is_same_v<decltype(K), const st2tost2<3u, float>>));
+    const auto K_ref = computeDerivative<m, 0>(hooke_stress, e);
+    const auto dK = getMixedPrecisionDerivativeFunction<m, float, 0>(hooke_stress);
+    const auto K2 = dK(e);
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        TFEL_TESTS_ASSERT(isRounded(K(i, j), K_ref(i, j)));
+        TFEL_TESTS_ASSERT(isRounded(K2(i, j), K_ref(i, j)));
+      }
+    }
+  }
+  // mixed precision gradients of scalar functions
+  template <tfel::math::enzyme::Mode m>
+  void test4() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using Stensor = stensor<3u, double>;
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto a = double{1.7};
+    // the second argument is held constant
+    const auto g = computeMixedPrecisionDerivative<m, float, 0>(
+        function<potential>, e, a);
+    TFEL_TESTS_STATIC_ASSERT(
+        (std::is_same_v<decltype(g), const stensor<3u, float>>));
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(isRounded(g(i), 2 * a * e(i)));
+    }
+    // units are preserved
+    const auto E = qt<Stress, double>{150e9};
+    const auto Phi = [E](const qt<NoUnit, double> v) { return E * v * v / 2; };
+    const auto s =
+        computeMixedPrecisionDerivative<m, float>(Phi, qt<NoUnit, double>{1e-2});
+    TFEL_TESTS_STATIC_ASSERT(
+        (std::is_same_v<decltype(s), const qt<Stress, float>>));
+    TFEL_TESTS_ASSERT(isRounded(s.getValue(), E.getValue() * 1e-2));
+  }
+  // mixed precision batches
+  template <tfel::math::enzyme::Mode m>
+  void test5() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using Stensor = stensor<3u, double>;
+    // the derivative of this function is not symmetric
+    const auto c = [](const Stensor& v) -> Stensor { return v(0) * v; };
+    auto x = std::vector<Stensor>(npoints);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto v = 0.1 * static_cast<double>(i);
+      x[i] = Stensor{v, 2 * v, 3, 4, 5 * v, 6};
+    }
+    auto K = std::vector<st2tost2<3u, float>>(npoints);
+    computeMixedPrecisionDerivativeBatch<m, float>(c, x, K);
+    for (std::size_t p = 0; p != npoints; ++p) {
+      for (unsigned short i = 0; i != 6; ++i) {
+        for (unsigned short j = 0; j != 6; ++j) {
+          const auto K_ref =
+              (i == j ? x[p](0) : 0) + (j == 0 ? x[p](i) : 0);
+          TFEL_TESTS_ASSERT(isRounded(K[p](i, j), K_ref));
+        }
+      }
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeMixedPrecision,
+                          "TFELMathEnzymeMixedPrecision");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-MixedPrecision.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,109 @@
+/*!
+ * \file   tests/ReverseModeTape.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   04/08/2025
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/ReverseModeTape.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+struct TFELMathEnzymeReverseModeTape final : public tfel::tests::TestCase {
+  TFELMathEnzymeReverseModeTape()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeReverseModeTape") {
+  }  // end of TFELMathEnzymeReverseModeTape
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return std::cos(x); };
+    const auto tape = ReverseModeTape(c, double{1});
+    TFEL_TESTS_ASSERT(std::abs(tape.getValue() - std::cos(1.)) < eps);
+    // the tape can be used several times
+    for (const auto seed : {1., 2., -3.}) {
+      const auto dx = tape.computeVectorJacobianProduct(seed);
+      TFEL_TESTS_ASSERT(std::abs(dx + seed * std::sin(1.)) < eps);
+    }
+    TFEL_TESTS_ASSERT(std::abs(tape.computeDerivative() + std::sin(1.)) < eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto hooke_potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    const auto e = Stensor{0.01, 0, 0, 0, 0, 0};
+    const auto tape = ReverseModeTape(hooke_potential, e);
+    TFEL_TESTS_ASSERT(std::abs(tape.getValue() - hooke_potential(e)) <
+                      E * eps);
+    const auto s = tape.computeDerivative();
+    const auto s_ref = eval(2 * mu * e + lambda * trace(e) * Stensor::Id());
+    TFEL_TESTS_ASSERT(abs(s - s_ref) < E * eps);
+    const auto s2 = tape.computeVectorJacobianProduct(2);
+    TFEL_TESTS_ASSERT(abs(s2 - 2 * s_ref) < E * eps);
+  }
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_law = [](const Stensor& e) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+    };
+    const auto e = Stensor{0.01, 0, 0, 0, 0, 0};
+    const auto tape = ReverseModeTape(hooke_law, e);
+    TFEL_TESTS_ASSERT(abs(tape.getValue() - hooke_law(e)) < E * eps);
+    const auto K = tape.computeDerivative();
+    const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < E * eps);
+    // vector-Jacobian product
+    const auto v = Stensor{1, 0, 0, 0, 0, 0};
+    const auto dx = tape.computeVectorJacobianProduct(v);
+    TFEL_TESTS_ASSERT(abs(dx - hooke_law(v)) < E * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeReverseModeTape,
+                          "TFELMathEnzymeReverseModeTape");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-ReverseModeTape.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,159 @@
+/*!
+ * \file   tests/checkpointed_loop.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ */
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/Enzyme/checkpointed_loop.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+/*!
+ * \brief a state counting the number of its live instances, used to check
+ * the memory used by the checkpointing schedule.
+ */
+struct CountedState : tfel::math::stensor<1u, double> {
+  //! \brief number of live instances
+  static inline std::size_t live = 0;
+  //! \brief maximum number of live instances
+  static inline std::size_t max_live = 0;
+  CountedState() { CountedState::increment(); }
+  CountedState(const CountedState& s) : tfel::math::stensor<1u, double>(s) {
+    CountedState::increment();
+  }
+  CountedState& operator=(const CountedState&) = default;
+  ~CountedState() { --(CountedState::live); }
+  static void increment() {
+    ++(CountedState::live);
+    CountedState::max_live =
+        std::max(CountedState::max_live, CountedState::live);
+  }
+};
+
+namespace tfel::math {
+
+  template <>
+  struct MathObjectTraits<CountedState>
+      : MathObjectTraits<stensor<1u, double>> {};
+
+}  // end of namespace tfel::math
+
+struct TFELMathEnzymeCheckpointedLoop final : public tfel::tests::TestCase {
+  TFELMathEnzymeCheckpointedLoop()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeCheckpointedLoop") {
+  }  // end of TFELMathEnzymeCheckpointedLoop
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    constexpr auto h = double{1e-3};
+    constexpr auto n = std::size_t{1000};
+    const auto step = [](const double x, const std::size_t k) {
+      return x * (1 - h * x) + h * static_cast<double>(k % 3);
+    };
+    const auto x0 = double{0.5};
+    // reference derivative computed by storing all the states
+    auto states = std::vector<double>{x0};
+    for (std::size_t k = 0; k != n; ++k) {
+      states.push_back(step(states.back(), k));
+    }
+    auto d_ref = double{1};
+    for (std::size_t k = 0; k != n; ++k) {
+      d_ref *= 1 - 2 * h * states[k];
+    }
+    TFEL_TESTS_ASSERT(std::abs(checkpointed_loop(n, step, x0) - states[n]) <
+                      eps);
+    for (const auto snapshots : {std::size_t{0}, std::size_t{1},
+                                 std::size_t{4}, std::size_t{16}}) {
+      const auto d = checkpointed_loop_vjp(n, step, x0, 1., snapshots);
+      TFEL_TESTS_ASSERT(std::abs(d - d_ref) < eps);
+    }
+    // derivative of an objective function of the final state
+    const auto objective = [](const double x) { return power<2>(x); };
+    const auto dJ = computeCheckpointedReverseModeDerivative(objective, n,
+                                                             step, x0, 4);
+    TFEL_TESTS_ASSERT(std::abs(dJ - 2 * states[n] * d_ref) < eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    constexpr auto h = double{1e-2};
+    constexpr auto n = std::size_t{500};
+    using Stensor = stensor<3u, double>;
+    // explicit integration of a linear relaxation
+    const auto step = [](const Stensor& s) -> Stensor { return (1 - h) * s; };
+    const auto objective = [](const Stensor& s) { return s | s; };
+    const auto s0 = Stensor{1, 2, 3, 4, 5, 6};
+    const auto f = std::pow(1 - h, static_cast<double>(n));
+    const auto dJ = computeCheckpointedReverseModeDerivative(objective, n,
+                                                             step, s0, 3);
+    TFEL_TESTS_ASSERT(abs(dJ - 2 * f * f * s0) < eps);
+  }
+  // the number of live states does not depend on the number of steps
+  void test3() {
+    using namespace tfel::math::enzyme;
+    constexpr auto h = double{1e-2};
+    const auto step = [](const CountedState& s) {
+      auto r = s;
+      for (unsigned short i = 0; i != s.size(); ++i) {
+        r[i] = s[i] - h * s[i] * s[i];
+      }
+      return r;
+    };
+    auto s0 = CountedState{};
+    auto w = CountedState{};
+    for (unsigned short i = 0; i != s0.size(); ++i) {
+      s0[i] = 0.5;
+      w[i] = 1;
+    }
+    // maximum number of states created by the call
+    const auto count = [&step, &s0, &w](const std::size_t n,
+                                         const std::size_t snapshots) {
+      const auto live = CountedState::live;
+      CountedState::max_live = live;
+      static_cast<void>(checkpointed_loop_vjp(n, step, s0, w, snapshots));
+      return CountedState::max_live - live;
+    };
+    // states required to differentiate one step without any snapshot
+    const auto overhead = std::max(count(20, 0), count(400, 0));
+    TFEL_TESTS_ASSERT(count(20, 0) == count(400, 0));
+    for (const auto snapshots : {std::size_t{1}, std::size_t{2},
+                                 std::size_t{4}}) {
+      for (const auto n : {std::size_t{20}, std::size_t{400}}) {
+        // at most one snapshot and one cotangent per level of recursion
+        TFEL_TESTS_ASSERT(count(n, snapshots) <= overhead + 2 * snapshots);
+      }
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeCheckpointedLoop,
+                          "TFELMathEnzymeCheckpointedLoop");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-checkpointed_loop.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -32,6 +32,8 @@ struct TFELMathEnzymeComputeDerivative final : public tfel::tests::TestCase {
     using namespace tfel::math;
     this->test1<tfel::math::enzyme::Mode::FORWARD>();
     this->test1<tfel::math::enzyme::Mode::REVERSE>();
+    this->test1<tfel::math::enzyme::Mode::AUTO>();
+    this->test2();
     return this->result;
   }  // end of execute
  private:
@@ -55,6 +57,45 @@ struct TFELMathEnzymeComputeDerivative final : public tfel::tests::TestCase {
     const auto dc3_dx = computeDerivative<m, 0>(c3, v);
     TFEL_TESTS_ASSERT(std::abs(dc3_dx + std::cos(v)) < eps);
   }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    const auto hooke_law = [](const Stensor& e) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+    };
+    const auto thermal_stress = [](const double T) -> Stensor {
+      return -(T - 293.15) * Stensor::Id();
+    };
+    const auto norm = [](const Stensor& e) -> double { return e | e; };
+    // reverse mode for scalar results, forward mode when the number of
+    // components of the variable does not exceed the one of the result
+    static_assert(getAutomaticMode<decltype(potential)>() == Mode::REVERSE);
+    static_assert(getAutomaticMode<decltype(hooke_law), 0>() == Mode::FORWARD);
+    static_assert(getAutomaticMode<0>(thermal_stress) == Mode::FORWARD);
+    static_assert(getAutomaticMode(norm) == Mode::REVERSE);
+    static_assert(ModeSelectionPolicy<double, Stensor>::input_size == 6);
+    static_assert(ModeSelectionPolicy<Stensor, double>::output_size == 6);
+    static_assert(ModeSelectionPolicy<double, double>::mode == Mode::REVERSE);
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto sig = computeDerivative<Mode::AUTO, 0>(potential, e);
+    TFEL_TESTS_ASSERT(abs(sig - hooke_law(e)) < E * eps);
+    const auto K = computeDerivative<Mode::AUTO, 0>(hooke_law, e);
+    const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < E * eps);
+    const auto dsig_dT = computeDerivative<Mode::AUTO, 0>(thermal_stress, 300.);
+    TFEL_TESTS_ASSERT(abs(dsig_dT + Stensor::Id()) < eps);
+  }
 };
 
 TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeDerivative,
@@ -0,0 +1,134 @@
+/*!
+ * \file   tests/computeDerivativeBatch.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   06/08/2025
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeDerivativeBatch.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+struct TFELMathEnzymeComputeDerivativeBatch final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeDerivativeBatch()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeDerivativeBatch") {
+  }  // end of TFELMathEnzymeComputeDerivativeBatch
+  tfel::tests::TestResult execute() override {
+    using tfel::math::enzyme::Mode;
+    this->test1<Mode::FORWARD>();
+    this->test1<Mode::REVERSE>();
+    this->test2<Mode::FORWARD>();
+    this->test2<Mode::REVERSE>();
+    this->test3<Mode::FORWARD>();
+    this->test3<Mode::REVERSE>();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  // number of points which is not a multiple of the size of the blocks
+  static constexpr std::size_t npoints = 11;
+  template <tfel::math::enzyme::Mode m>
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return std::cos(x); };
+    auto x = std::vector<double>(npoints);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      x[i] = 0.1 * static_cast<double>(i);
+    }
+    auto dc = std::vector<double>(npoints);
+    computeDerivativeBatch<m>(c, x, dc);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(dc[i] + std::sin(x[i])) < eps);
+    }
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto hooke_potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    auto e = std::vector<Stensor>(npoints);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto v = 1e-3 * static_cast<double>(i);
+      e[i] = Stensor{v, -v, 2 * v, v / 2, 0, 0};
+    }
+    auto s = std::vector<Stensor>(npoints);
+    computeDerivativeBatch<m>(hooke_potential, e, s);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto s_ref =
+          eval(2 * mu * e[i] + lambda * trace(e[i]) * Stensor::Id());
+      TFEL_TESTS_ASSERT(abs(s[i] - s_ref) < E * eps);
+    }
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // the derivative of this function is not symmetric
+    const auto c = [](const Stensor& v) -> Stensor { return v(0) * v; };
+    auto x = std::vector<Stensor>(npoints);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto v = static_cast<double>(i);
+      x[i] = Stensor{v, 2 * v, 3, 4, 5 * v, 6};
+    }
+    auto K = std::vector<Stensor4>(npoints);
+    computeDerivativeBatch<m>(c, x, K);
+    for (std::size_t p = 0; p != npoints; ++p) {
+      auto K_ref = Stensor4{};
+      for (unsigned short i = 0; i != 6; ++i) {
+        for (unsigned short j = 0; j != 6; ++j) {
+          K_ref(i, j) = (i == j ? x[p](0) : 0) + (j == 0 ? x[p](i) : 0);
+        }
+      }
+      TFEL_TESTS_ASSERT(abs(K[p] - K_ref) < eps);
+    }
+  }
+  void test4() {
+    using namespace tfel::math::enzyme;
+    const auto c = [](const double x) { return std::cos(x); };
+    auto x = std::vector<double>(npoints);
+    auto dc = std::vector<double>(npoints - 1);
+    TFEL_TESTS_CHECK_THROW(computeDerivativeBatch<Mode::REVERSE>(c, x, dc),
+                           std::invalid_argument);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeDerivativeBatch,
+                          "TFELMathEnzymeComputeDerivativeBatch");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeDerivativeBatch.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
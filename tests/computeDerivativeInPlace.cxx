@@ -0,0 +1,125 @@
+/*!
+ * \file   tests/computeDerivativeInPlace.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   07/08/2025
+ */
+
+#include <cmath>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Math/Array/View.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeDerivativeInPlace.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double f2(const double x, const double y) {
+  return x + tfel::math::power<2>(y);
+}
+
+struct TFELMathEnzymeComputeDerivativeInPlace final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeDerivativeInPlace()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeDerivativeInPlace") {
+  }  // end of TFELMathEnzymeComputeDerivativeInPlace
+  tfel::tests::TestResult execute() override {
+    using tfel::math::enzyme::Mode;
+    this->test1<Mode::FORWARD>();
+    this->test1<Mode::REVERSE>();
+    this->test2<Mode::FORWARD>();
+    this->test2<Mode::REVERSE>();
+    this->test3<Mode::FORWARD>();
+    this->test3<Mode::REVERSE>();
+    return this->result;
+  }  // end of execute
+ private:
+  template <tfel::math::enzyme::Mode m>
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    auto df = double{};
+    computeDerivativeInPlace<m, 1>(df, function<f2>, 2, 3);
+    TFEL_TESTS_ASSERT(std::abs(df - 6) < eps);
+    accumulateDerivative<m, 0>(df, function<f2>, 2, 3);
+    TFEL_TESTS_ASSERT(std::abs(df - 7) < eps);
+    const auto c = [](const double x) { return std::cos(x); };
+    computeDerivativeInPlace<m>(df, c, 1.);
+    TFEL_TESTS_ASSERT(std::abs(df + std::sin(1.)) < eps);
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto hooke_potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    const auto e = Stensor{0.01, 0, 0, 0, 0, 0};
+    const auto s_ref = eval(2 * mu * e + lambda * trace(e) * Stensor::Id());
+    // the storage is filled with garbage which must be discarded
+    auto s = Stensor(1);
+    computeDerivativeInPlace<m>(s, hooke_potential, e);
+    TFEL_TESTS_ASSERT(abs(s - s_ref) < E * eps);
+    accumulateDerivative<m>(s, hooke_potential, e);
+    TFEL_TESTS_ASSERT(abs(s - 2 * s_ref) < E * eps);
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_law = [](const Stensor& e) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+    };
+    const auto e = Stensor{0.01, 0, 0, 0, 0, 0};
+    const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    // the derivative is scattered in the second block of a raw buffer
+    auto buffer = std::array<double, 72>{};
+    buffer.fill(1);
+    computeDerivativeInPlace<m>(map<Stensor4>(buffer.data() + 36), hooke_law,
+                                e);
+    accumulateDerivative<m>(map<Stensor4>(buffer.data() + 36), hooke_law, e);
+    for (std::size_t i = 0; i != 36; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(buffer[i] - 1) < eps);
+      TFEL_TESTS_ASSERT(std::abs(buffer[36 + i] - 2 * K_ref.data()[i]) <
+                        E * eps);
+    }
+    auto K = Stensor4{};
+    computeDerivativeInPlace<m>(K, hooke_law, e);
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < E * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeDerivativeInPlace,
+                          "TFELMathEnzymeComputeDerivativeInPlace");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeDerivativeInPlace.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+/*!
+ * \file   tests/computeDerivativeParallel.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   07/08/2025
+ */
+
+#include <cmath>
+#include <array>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeDerivative.hxx"
+#include "TFEL/Math/Enzyme/computeDerivativeParallel.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+struct TFELMathEnzymeComputeDerivativeParallel final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeDerivativeParallel()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeDerivativeParallel") {
+  }  // end of TFELMathEnzymeComputeDerivativeParallel
+  tfel::tests::TestResult execute() override {
+    using tfel::math::enzyme::Mode;
+    this->test1<Mode::FORWARD>();
+    this->test1<Mode::REVERSE>();
+    this->test2<Mode::FORWARD>();
+    this->test2<Mode::REVERSE>();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  static constexpr std::size_t npoints = 1001;
+  static constexpr std::size_t nthreads = 4;
+  template <tfel::math::enzyme::Mode m>
+  void test1() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    // the material coefficients are captured by value and are shared by all
+    // the threads through the constant pointer to the callable
+    const auto lambda = computeLambda(E, nu);
+    const auto mu = computeMu(E, nu);
+    const auto hooke_potential = [lambda, mu](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    auto e = std::vector<Stensor>(npoints);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto v = 1e-5 * static_cast<double>(i);
+      e[i] = Stensor{v, -v, 2 * v, v / 2, 0, -v};
+    }
+    auto s = std::vector<Stensor>(npoints);
+    computeDerivativeParallel<m>(hooke_potential, e, s, nthreads);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto s_ref =
+          eval(2 * mu * e[i] + lambda * trace(e[i]) * Stensor::Id());
+      TFEL_TESTS_ASSERT(abs(s[i] - s_ref) < E * eps);
+    }
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto c = [](const Stensor& v) -> Stensor { return v(0) * v; };
+    auto x = std::vector<Stensor>(npoints);
+    for (std::size_t i = 0; i != npoints; ++i) {
+      const auto v = 1e-3 * static_cast<double>(i);
+      x[i] = Stensor{v, 2 * v, 3, 4, 5 * v, 6};
+    }
+    auto K = std::vector<Stensor4>(npoints);
+    computeDerivativeParallel<m>(c, x, K, nthreads);
+    auto K2 = std::vector<Stensor4>(npoints);
+    computeDerivativeBatch<m>(c, x, K2);
+    for (std::size_t p = 0; p != npoints; ++p) {
+      TFEL_TESTS_ASSERT(abs(K[p] - K2[p]) < eps);
+    }
+  }
+  void test3() {
+    // concurrent calls to computeDerivative sharing the same callable
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto a = double{2};
+    const auto c = [a](const Stensor& v) { return a * (v | v); };
+    auto results = std::array<bool, nthreads>{};
+    {
+      auto threads = std::vector<std::jthread>{};
+      for (std::size_t t = 0; t != nthreads; ++t) {
+        threads.emplace_back([&c, &results, t, a] {
+          auto ok = true;
+          for (std::size_t i = 0; i != npoints; ++i) {
+            const auto v = static_cast<double>(t * npoints + i);
+            const auto x = Stensor{v, 0, -v, 0, 1, 0};
+            const auto dc = computeDerivative<Mode::REVERSE, 0>(c, x);
+            ok = ok && (abs(dc - 2 * a * x) < eps * (1 + abs(x)));
+          }
+          results[t] = ok;
+        });
+      }
+    }
+    for (const auto r : results) {
+      TFEL_TESTS_ASSERT(r);
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeDerivativeParallel,
+                          "TFELMathEnzymeComputeDerivativeParallel");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeDerivativeParallel.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,89 @@
+/*!
+ * \file   tests/computeDirectionalDerivative.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   12/08/2025
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeDirectionalDerivative.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double f(const double x) { return tfel::math::power<4>(x); }
+
+struct TFELMathEnzymeComputeDirectionalDerivative final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeDirectionalDerivative()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeDirectionalDerivative") {
+  }  // end of TFELMathEnzymeComputeDirectionalDerivative
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  // directional derivatives
+  void test1() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    const auto c = [](const double x) { return std::sin(x); };
+    TFEL_TESTS_ASSERT(std::abs(computeDirectionalDerivative<3>(c, 1., 2.) +
+                               8 * std::cos(1.)) < eps);
+    TFEL_TESTS_ASSERT(
+        std::abs(computeDirectionalDerivative<3>(function<f>, 2., 1.) - 48) <
+        eps);
+    using Stensor = stensor<3u, double>;
+    const auto w = [](const Stensor& v) { return power<2>(v | v); };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const auto d = Stensor{1, 0, 2, 0, 0, 3};
+    const auto d3w = 24 * (s | d) * (d | d);
+    TFEL_TESTS_ASSERT(std::abs(computeDirectionalDerivative<3>(w, s, d) - d3w) <
+                      d3w * eps);
+  }
+  // second directional derivative of the hooke potential
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    const Stensor4 K = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto d = Stensor{1, 0, 2, 0, 0, 3};
+    const Stensor Kd = K * d;
+    const auto dKd = d | Kd;
+    TFEL_TESTS_ASSERT(
+        std::abs(computeDirectionalDerivative<2>(hooke_potential, e, d) -
+                 dKd) < dKd * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeDirectionalDerivative,
+                          "TFELMathEnzymeComputeDirectionalDerivative");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeDirectionalDerivative.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,162 @@
+/*!
+ * \file   tests/computeForwardModeDerivative.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   20/08/2024
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/getForwardModeDerivativeFunction.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+struct TFELMathEnzymeComputeForwardModeDerivative final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeForwardModeDerivative()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeForwardModeDerivative") {
+  }  // end of TFELMathEnzymeComputeForwardModeDerivative
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return tfel::math::power<3>(x); };
+    TFEL_TESTS_ASSERT(std::abs(computeForwardModeDerivative(c, 2.) - 12) <
+                      eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const auto c = [](const Stensor& v) { return v | v; };
+    const auto dc = computeForwardModeDerivative(c, s);
+    TFEL_TESTS_ASSERT(abs(dc - 2 * s) < eps);
+  }
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // the derivative of this function is not symmetric, which allows to
+    // check that the columns of the derivative are stored at the right place
+    const auto c = [](const Stensor& v) -> Stensor { return v(0) * v; };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const auto K = computeForwardModeDerivative(c, s);
+    auto K_ref = Stensor4{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        K_ref(i, j) = (i == j ? s(0) : 0) + (j == 0 ? s(i) : 0);
+      }
+    }
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < eps);
+  }
+  void test4() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_law = [](const Stensor& e) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+    };
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto K =
+        computeForwardModeDerivative<Symmetry::SYMMETRIZE>(hooke_law, e);
+    const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < E * eps);
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        TFEL_TESTS_ASSERT(K(i, j) == K(j, i));
+      }
+    }
+  }
+  void test5() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto alpha = double{1e-5};
+    constexpr auto T0 = double{293.15};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto kappa = lambda + 2 * mu / 3;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // thermo-elastic stress: the derivative with respect to the temperature
+    // is a small input and wide output derivative
+    const auto stress = [](const Stensor& e, const double T) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id() -
+             3 * kappa * alpha * (T - T0) * Stensor::Id();
+    };
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto T = double{400};
+    const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    const Stensor dsig_dT_ref = -3 * kappa * alpha * Stensor::Id();
+    const auto dsig_dT = computeForwardModeDerivative<1>(stress, e, T);
+    TFEL_TESTS_ASSERT(abs(dsig_dT - dsig_dT_ref) < E * eps);
+    const auto K = computeForwardModeDerivative<0>(stress, e, T);
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < E * eps);
+    // joint derivatives, computed by the same vector forward pass
+    const auto [K2, dsig_dT2] = computeForwardModeDerivative<0, 1>(stress, e, T);
+    TFEL_TESTS_ASSERT(abs(K2 - K_ref) < E * eps);
+    TFEL_TESTS_ASSERT(abs(dsig_dT2 - dsig_dT_ref) < E * eps);
+    const auto [dsig_dT3, K3] = computeForwardModeDerivative<1, 0>(stress, e, T);
+    TFEL_TESTS_ASSERT(abs(K3 - K_ref) < E * eps);
+    TFEL_TESTS_ASSERT(abs(dsig_dT3 - dsig_dT_ref) < E * eps);
+    const auto [K4, dsig_dT4] = computeForwardModeDerivative(stress, e, T);
+    TFEL_TESTS_ASSERT(abs(K4 - K_ref) < E * eps);
+    TFEL_TESTS_ASSERT(abs(dsig_dT4 - dsig_dT_ref) < E * eps);
+    // increments of both arguments in a single call to fwddiff
+    const auto de = Stensor{1e-3, 0, 0, 2e-3, 0, 0};
+    const auto dT = double{2};
+    const auto dsig = fwddiff(stress, make_vdv<Stensor>(e, de),
+                              make_vdv<double>(T, dT));
+    const Stensor dsig_ref = K_ref * de + dsig_dT_ref * dT;
+    TFEL_TESTS_ASSERT(abs(dsig - dsig_ref) < E * eps);
+    // derivative function with respect to the second argument
+    const auto dstress_dT = getForwardModeDerivativeFunction<1>(stress);
+    TFEL_TESTS_ASSERT(abs(dstress_dT(e, T) - dsig_dT_ref) < E * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeForwardModeDerivative,
+                          "TFELMathEnzymeComputeForwardModeDerivative");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeForwardModeDerivative.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,86 @@
+/*!
+ * \file   tests/computeHessianVectorProduct.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   11/08/2025
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeHessianVectorProduct.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double f(const double x) { return tfel::math::power<3>(x); }
+
+struct TFELMathEnzymeComputeHessianVectorProduct final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeHessianVectorProduct()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeHessianVectorProduct") {
+  }  // end of TFELMathEnzymeComputeHessianVectorProduct
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return std::sin(x); };
+    TFEL_TESTS_ASSERT(
+        std::abs(computeHessianVectorProduct(c, 1., 2.) + 2 * std::sin(1.)) <
+        eps);
+    TFEL_TESTS_ASSERT(
+        std::abs(computeHessianVectorProduct(function<f>, 2., 3.) - 36) <
+        eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    const Stensor4 K = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto de = Stensor{1, 0, 2, 0, 0, 3};
+    const Stensor Kde = K * de;
+    TFEL_TESTS_ASSERT(abs(computeHessianVectorProduct(hooke_potential, e, de) -
+                          Kde) < E * eps);
+    // a non quadratic potential
+    const auto c = [](const Stensor& v) { return power<2>(v | v); };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const Stensor Hv = 4 * (s | s) * de + 8 * (s | de) * s;
+    TFEL_TESTS_ASSERT(abs(computeHessianVectorProduct(c, s, de) - Hv) <
+                      1e-12);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeHessianVectorProduct,
+                          "TFELMathEnzymeComputeHessianVectorProduct");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeHessianVectorProduct.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
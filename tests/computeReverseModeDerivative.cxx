@@ -63,6 +63,9 @@ struct TFELMathEnzymeComputeReversModeDerivative final
     this->test5<stensor_common::FSESJACOBIEIGENSOLVER>();
     this->test6();
     this->test7();
+    this->test8();
+    this->test9();
+    this->test10();
     return this->result;
   }  // end of execute
  private:
@@ -199,6 +202,89 @@ struct TFELMathEnzymeComputeReversModeDerivative final
         lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
     TFEL_TESTS_ASSERT(abs(K - Kr) < E * eps);
   }
+  void test8() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // the derivative with respect to the second variable is not symmetric,
+    // which allows to check that the rows of the derivative are stored at
+    // the right place
+    const auto c = [](const double a, const Stensor& v) -> Stensor {
+      return a * v(0) * v;
+    };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const auto K = computeReverseModeDerivative<1>(c, 2, s);
+    auto K_ref = Stensor4{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        K_ref(i, j) = 2 * ((i == j ? s(0) : 0) + (j == 0 ? s(i) : 0));
+      }
+    }
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < eps);
+    const auto ds = computeReverseModeDerivative<0>(c, 2, s);
+    TFEL_TESTS_ASSERT(abs(ds - s(0) * s) < eps);
+  }
+  void test9() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    // free energy depending on the strain, the temperature, the damage and
+    // an hardening variable
+    const auto psi = [](const Stensor& e, const double T, const double d,
+                        const double p) {
+      return (1 - d) * (e | e) + power<2>(T - 293.15) / 2 + 3 * power<2>(p);
+    };
+    const auto e = Stensor{1, 2, 3, 4, 5, 6};
+    const auto T = double{300};
+    const auto d = double{0.25};
+    const auto p = double{0.5};
+    const auto dpsi_de = computeReverseModeDerivative<0>(psi, e, T, d, p);
+    TFEL_TESTS_ASSERT(abs(dpsi_de - 2 * (1 - d) * e) < eps);
+    const auto dpsi_dp = computeReverseModeDerivative<3>(psi, e, T, d, p);
+    TFEL_TESTS_ASSERT(std::abs(dpsi_dp - 6 * p) < eps);
+    // the derivatives are returned in the order of the indices
+    const auto [dpsi_dp2, dpsi_de2, dpsi_dd] =
+        computeReverseModeDerivative<3, 0, 2>(psi, e, T, d, p);
+    TFEL_TESTS_ASSERT(std::abs(dpsi_dp2 - 6 * p) < eps);
+    TFEL_TESTS_ASSERT(abs(dpsi_de2 - 2 * (1 - d) * e) < eps);
+    TFEL_TESTS_ASSERT(std::abs(dpsi_dd + (e | e)) < eps);
+    const auto [g0, g1, g2, g3] = computeReverseModeDerivative(psi, e, T, d, p);
+    TFEL_TESTS_ASSERT(abs(g0 - 2 * (1 - d) * e) < eps);
+    TFEL_TESTS_ASSERT(std::abs(g1 - (T - 293.15)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(g2 + (e | e)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(g3 - 6 * p) < eps);
+  }
+  void test10() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // callables returning a fourth order tensor
+    const auto c = [](const Stensor& v) -> Stensor4 {
+      return (v | v) * Stensor4::Id();
+    };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    auto dc = computeReverseModeDerivative(c, s);
+    auto error = double{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        for (unsigned short k = 0; k != 6; ++k) {
+          const auto v = (i == j) ? 2 * s(k) : 0;
+          error = std::max(error, std::abs(dc(i, j, k) - v));
+        }
+      }
+    }
+    TFEL_TESTS_ASSERT(error < eps);
+    const auto c2 = [](const double a) -> Stensor4 {
+      return a * a * Stensor4::IxI();
+    };
+    const auto dc2 = computeReverseModeDerivative(c2, 2.);
+    TFEL_TESTS_ASSERT(abs(dc2 - 4 * Stensor4::IxI()) < eps);
+  }
 };
 
 TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeReversModeDerivative,
@@ -0,0 +1,100 @@
+/*!
+ * \file   tests/computeSparseForwardModeDerivative.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   13/08/2025
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/Enzyme/computeSparseForwardModeDerivative.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+struct TFELMathEnzymeComputeSparseForwardModeDerivative final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeSparseForwardModeDerivative()
+      : tfel::tests::TestCase(
+            "TFEL/Math/Enzyme",
+            "TFELMathEnzymeComputeSparseForwardModeDerivative") {
+  }  // end of TFELMathEnzymeComputeSparseForwardModeDerivative
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief compile-time coloring
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto d = computeColumnColoring(makeDiagonalSparsityPattern<20>());
+    static_assert(d.number_of_colors == 1);
+    constexpr auto t = computeColumnColoring(makeBandedSparsityPattern<20, 1, 1>());
+    static_assert(t.number_of_colors == 3);
+    static_assert((t.colors[0] == 0) && (t.colors[1] == 1) &&
+                  (t.colors[2] == 2) && (t.colors[3] == 0));
+    constexpr auto p = SparsityPattern<2, 3>{}.set(0, 0).set(0, 1).set(1, 2);
+    constexpr auto c = computeColumnColoring(p);
+    static_assert(c.number_of_colors == 2);
+    static_assert(c.colors[2] == 0);
+    TFEL_TESTS_ASSERT(t.number_of_colors == 3);
+  }
+  //! \brief tridiagonal jacobian
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    constexpr unsigned short N = 20;
+    using Vector = tvector<N, double>;
+    const auto c = [](const Vector& x) -> Vector {
+      auto r = Vector{};
+      for (unsigned short i = 0; i != N; ++i) {
+        r(i) = x(i) * x(i);
+        if (i > 0) {
+          r(i) += 2 * x(i - 1);
+        }
+        if (i + 1 < N) {
+          r(i) += x(i) * x(i + 1);
+        }
+      }
+      return r;
+    };
+    auto x = Vector{};
+    for (unsigned short i = 0; i != N; ++i) {
+      x(i) = 1 + i / double{N};
+    }
+    constexpr auto pattern = makeBandedSparsityPattern<N, 1, 1>();
+    const auto J = computeSparseForwardModeDerivative<pattern>(c, x);
+    auto error = double{0};
+    for (unsigned short i = 0; i != N; ++i) {
+      for (unsigned short j = 0; j != N; ++j) {
+        auto Jij = double{0};
+        if (j == i) {
+          Jij = 2 * x(i) + (i + 1 < N ? x(i + 1) : 0);
+        } else if (j + 1 == i) {
+          Jij = 2;
+        } else if (j == i + 1) {
+          Jij = x(i);
+        }
+        error = std::max(error, std::abs(J(i, j) - Jij));
+      }
+    }
+    TFEL_TESTS_ASSERT(error < eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeSparseForwardModeDerivative,
+                          "TFELMathEnzymeComputeSparseForwardModeDerivative");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeSparseForwardModeDerivative.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
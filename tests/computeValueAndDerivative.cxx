@@ -0,0 +1,142 @@
+/*!
+ * \file   tests/computeValueAndDerivative.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   05/08/2025
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include "TFEL/Math/qt.hxx"
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/computeValueAndDerivative.hxx"
+#include "TFEL/Math/Enzyme/getValueAndDerivativeFunction.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double f2(const double x, const double y) {
+  return x + tfel::math::power<2>(y);
+}
+
+struct TFELMathEnzymeComputeValueAndDerivative final
+    : public tfel::tests::TestCase {
+  TFELMathEnzymeComputeValueAndDerivative()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeComputeValueAndDerivative") {
+  }  // end of TFELMathEnzymeComputeValueAndDerivative
+  tfel::tests::TestResult execute() override {
+    using tfel::math::enzyme::Mode;
+    this->test1<Mode::FORWARD>();
+    this->test1<Mode::REVERSE>();
+    this->test2<Mode::FORWARD>();
+    this->test2<Mode::REVERSE>();
+    this->test3<Mode::FORWARD>();
+    this->test3<Mode::REVERSE>();
+    this->test4<Mode::FORWARD>();
+    this->test4<Mode::REVERSE>();
+    return this->result;
+  }  // end of execute
+ private:
+  template <tfel::math::enzyme::Mode m>
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return std::cos(x); };
+    const auto [v, dv] = computeValueAndDerivative<m>(c, 1.);
+    TFEL_TESTS_ASSERT(std::abs(v - std::cos(1.)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(dv + std::sin(1.)) < eps);
+    const auto [v2, dv2] = computeValueAndDerivative<m, 1>(function<f2>, 2, 3);
+    TFEL_TESTS_ASSERT(std::abs(v2 - 11) < eps);
+    TFEL_TESTS_ASSERT(std::abs(dv2 - 6) < eps);
+    const auto [v3, dv3] = computeValueAndDerivative<m, 0>(function<f2>, 2, 3);
+    TFEL_TESTS_ASSERT(std::abs(v3 - 11) < eps);
+    TFEL_TESTS_ASSERT(std::abs(dv3 - 1) < eps);
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    const auto hooke_potential = [](const Stensor& e) {
+      return (lambda / 2) * power<2>(trace(e)) + mu * (e | e);
+    };
+    const auto e = Stensor{0.01, 0, 0, 0, 0, 0};
+    const auto [w, s] = computeValueAndDerivative<m>(hooke_potential, e);
+    TFEL_TESTS_ASSERT(std::abs(w - hooke_potential(e)) < E * eps);
+    const auto s_ref = eval(2 * mu * e + lambda * trace(e) * Stensor::Id());
+    TFEL_TESTS_ASSERT(abs(s - s_ref) < E * eps);
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_law = [](const Stensor& e) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+    };
+    const auto e = Stensor{0.01, 0, 0, 0, 0, 0};
+    const auto [sig, K] = computeValueAndDerivative<m>(hooke_law, e);
+    TFEL_TESTS_ASSERT(abs(sig - hooke_law(e)) < E * eps);
+    const Stensor4 K_ref = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < E * eps);
+  }
+  template <tfel::math::enzyme::Mode m>
+  void test4() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // the derivative with respect to the second argument is not symmetric
+    const auto c = [](const double a, const Stensor& v) -> Stensor {
+      return a * v(0) * v;
+    };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const auto dc = getValueAndDerivativeFunction<m, 1>(c);
+    const auto [v, K] = dc(2, s);
+    TFEL_TESTS_ASSERT(abs(v - c(2, s)) < eps);
+    auto K_ref = Stensor4{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        K_ref(i, j) = 2 * ((i == j ? s(0) : 0) + (j == 0 ? s(i) : 0));
+      }
+    }
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < eps);
+    const auto [v2, ds] = getValueAndDerivativeFunction<m, 0>(c)(2, s);
+    TFEL_TESTS_ASSERT(abs(v2 - c(2, s)) < eps);
+    TFEL_TESTS_ASSERT(abs(ds - s(0) * s) < eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeComputeValueAndDerivative,
+                          "TFELMathEnzymeComputeValueAndDerivative");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-computeValueAndDerivative.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
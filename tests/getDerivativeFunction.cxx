@@ -29,6 +29,7 @@ struct TFELMathEnzymeGetDerivativeFunction final : public tfel::tests::TestCase
     this->test1<tfel::math::enzyme::Mode::FORWARD>();
     this->test2<tfel::math::enzyme::Mode::REVERSE>();
     this->test2<tfel::math::enzyme::Mode::FORWARD>();
+    this->test3();
     return this->result;
   }  // end of execute
  private:
@@ -68,6 +69,48 @@ struct TFELMathEnzymeGetDerivativeFunction final : public tfel::tests::TestCase
     const auto K = stiffness(e);
     const auto K_ref = eval(2 * mu * Stensor4::Id() + lambda * Stensor4::IxI());
     TFEL_TESTS_ASSERT(abs(K - K_ref) < eps * E);
+    // hessians are symmetrized
+    const auto potential = [](const Stensor& v) {
+      return power<3>(trace(v)) + v(0) * (v | v);
+    };
+    const auto K2 = getDerivativeFunction<m, 0, 0>(potential)(
+        Stensor{0.1, 0.2, 0.3, 0.4});
+    for (unsigned short i = 0; i != 4; ++i) {
+      for (unsigned short j = 0; j != 4; ++j) {
+        TFEL_TESTS_ASSERT(K2(i, j) == K2(j, i));
+      }
+    }
+  }
+  void test3() {
+    using namespace tfel::math;
+    using namespace tfel::material;
+    using namespace tfel::math::enzyme;
+    using Stensor = stensor<2u, double>;
+    using Stensor4 = st2tost2<2u, double>;
+    constexpr auto eps = double{1e-14};
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    // hessians are computed by forward-over-reverse differentiation
+    const auto f = [](const double x) { return power<4>(x); };
+    const auto d3f = getDerivativeFunction<Mode::REVERSE, 0, 0, 0>(f);
+    TFEL_TESTS_ASSERT(std::abs(d3f(2) - 48) < eps);
+    const auto hooke_potential = [](const double a, const Stensor& e) {
+      return a * ((lambda / 2) * power<2>(trace(e)) + mu * (e | e));
+    };
+    const auto stiffness =
+        getDerivativeFunction<Mode::REVERSE, 1, 1>(hooke_potential);
+    const auto e = Stensor{0.01, 0, 0, 0};
+    const auto K = stiffness(2, e);
+    const auto K_ref =
+        eval(2 * (2 * mu * Stensor4::Id() + lambda * Stensor4::IxI()));
+    TFEL_TESTS_ASSERT(abs(K - K_ref) < eps * E);
+    // mixed derivatives are still computed by nested reverse passes
+    const auto dstress_da =
+        getDerivativeFunction<Mode::REVERSE, 1, 0>(hooke_potential);
+    const auto s_ref = eval(2 * mu * e + lambda * trace(e) * Stensor::Id());
+    TFEL_TESTS_ASSERT(abs(dstress_da(2, e) - s_ref) < eps * E);
   }
 };
 
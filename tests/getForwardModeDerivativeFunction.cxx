@@ -6,6 +6,7 @@
  */
 
 #include <cmath>
+#include <limits>
 #include <cstdlib>
 #include <iostream>
 #include <type_traits>
@@ -88,7 +89,7 @@ struct TFELMathEnzymeGetForwardModeDerivativeFunction final
   void test4() {
     using namespace tfel::math;
     using namespace tfel::math::enzyme;
-    constexpr auto eps = 1e-14;
+    constexpr auto eps = 10 * std::numeric_limits<float>::epsilon();
     auto E = qt<Stress, float>{150e9};
     auto Phi = [E](const qt<NoUnit, float> e) { return E * e * e / 2; };
     const auto stress = getForwardModeDerivativeFunction<0>(Phi);
@@ -98,7 +99,7 @@ struct TFELMathEnzymeGetForwardModeDerivativeFunction final
     const auto K = stiffness(e);
     static_assert(std::is_same_v<decltype(s), const qt<Stress, float>>);
     static_assert(std::is_same_v<decltype(K), const qt<Stress, float>>);
-    TFEL_TESTS_ASSERT(abs(s - E * e) < E * eps);
+    TFEL_TESTS_ASSERT(abs(s - E * e) < E * e * eps);
     TFEL_TESTS_ASSERT(abs(K - E) < E * eps);
   }
 
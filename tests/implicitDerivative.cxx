@@ -0,0 +1,88 @@
+/*!
+ * \file   tests/implicitDerivative.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   11/08/2025
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Math/Enzyme/computeForwardModeDerivative.hxx"
+#include "TFEL/Math/Enzyme/implicitDerivative.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double residual(const double y, const double x) {
+  return tfel::math::power<3>(y) + x * y - 2;
+}
+
+struct TFELMathEnzymeImplicitDerivative final : public tfel::tests::TestCase {
+  TFELMathEnzymeImplicitDerivative()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme",
+                              "TFELMathEnzymeImplicitDerivative") {
+  }  // end of TFELMathEnzymeImplicitDerivative
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    const auto x = double{1};
+    // Newton loop
+    auto y = double{0.5};
+    for (int i = 0; i != 20; ++i) {
+      y -= residual(y, x) / (3 * power<2>(y) + x);
+    }
+    TFEL_TESTS_ASSERT(std::abs(residual(y, x)) < eps);
+    const auto dy_dx_ref = -y / (3 * power<2>(y) + x);
+    TFEL_TESTS_ASSERT(
+        std::abs(implicitDerivative(function<residual>, y, x) - dy_dx_ref) <
+        eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-12};
+    constexpr auto a = double{1};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto R = [](const Stensor& y, const Stensor& x) -> Stensor {
+      return y + a * (y | y) * y - x;
+    };
+    const auto x = Stensor{0.1, 0.2, 0.3, 0, 0.1, 0};
+    // fixed point iterations
+    auto y = x;
+    for (int i = 0; i != 100; ++i) {
+      y = x / (1 + a * (y | y));
+    }
+    TFEL_TESTS_ASSERT(abs(R(y, x)) < eps);
+    const auto dy_dx = implicitDerivative(R, y, x);
+    const Stensor4 dR_dy = computeForwardModeDerivative<0>(R, y, x);
+    const auto v = Stensor{1, 0, 2, 0, 0, 3};
+    const Stensor dy = dy_dx * v;
+    TFEL_TESTS_ASSERT(abs(dR_dy * dy - v) < eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeImplicitDerivative,
+                          "TFELMathEnzymeImplicitDerivative");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-implicitDerivative.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
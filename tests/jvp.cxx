@@ -0,0 +1,94 @@
+/*!
+ * \file   tests/jvp.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   10/08/2025
+ */
+
+#include <cmath>
+#include <tuple>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/jvp.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double f2(const double x, const double y) {
+  return x + tfel::math::power<2>(y);
+}
+
+struct TFELMathEnzymeJVP final : public tfel::tests::TestCase {
+  TFELMathEnzymeJVP()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme", "TFELMathEnzymeJVP") {
+  }  // end of TFELMathEnzymeJVP
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return std::cos(x); };
+    TFEL_TESTS_ASSERT(std::abs(jvp(c, 1., 2.) + 2 * std::sin(1.)) < eps);
+    // derivative with respect to y in the direction 3
+    TFEL_TESTS_ASSERT(
+        std::abs(jvp<1>(function<f2>, std::make_tuple(2., 1.), 3.) - 6) < eps);
+    // directions of both arguments
+    TFEL_TESTS_ASSERT(
+        std::abs(jvp(function<f2>, std::make_tuple(2., 1.), 1., 3.) - 7) <
+        eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    const auto hooke_law = [](const Stensor& e) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id();
+    };
+    const auto stress = [](const Stensor& e, const double T) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id() -
+             E * 1e-5 * (T - 293.15) * Stensor::Id();
+    };
+    const Stensor4 K = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto de = Stensor{1, 0, 2, 0, 0, 3};
+    const auto T = double{400};
+    // matrix-free application of the stiffness
+    const Stensor Kde = K * de;
+    TFEL_TESTS_ASSERT(abs(jvp(hooke_law, e, de) - Kde) < E * eps);
+    TFEL_TESTS_ASSERT(abs(jvp<0>(stress, std::tie(e, T), de) - Kde) <
+                      E * eps);
+    const Stensor dsig = Kde - 2 * E * 1e-5 * Stensor::Id();
+    TFEL_TESTS_ASSERT(abs(jvp<1, 0>(stress, std::tie(e, T), 2., de) - dsig) <
+                      E * eps);
+    TFEL_TESTS_ASSERT(abs(jvp(stress, std::tie(e, T), de, 2.) - dsig) <
+                      E * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeJVP, "TFELMathEnzymeJVP");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-jvp.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,94 @@
+/*!
+ * \file   tests/vjp.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   10/08/2025
+ */
+
+#include <cmath>
+#include <tuple>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/power.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorConceptIO.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx"
+#include "TFEL/Material/Lame.hxx"
+#include "TFEL/Math/Enzyme/vjp.hxx"
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double f2(const double x, const double y) {
+  return x + tfel::math::power<2>(y);
+}
+
+struct TFELMathEnzymeVJP final : public tfel::tests::TestCase {
+  TFELMathEnzymeVJP()
+      : tfel::tests::TestCase("TFEL/Math/Enzyme", "TFELMathEnzymeVJP") {
+  }  // end of TFELMathEnzymeVJP
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    using namespace tfel::math::enzyme;
+    constexpr auto eps = double{1e-14};
+    const auto c = [](const double x) { return std::cos(x); };
+    TFEL_TESTS_ASSERT(std::abs(vjp(c, 1., 2.) + 2 * std::sin(1.)) < eps);
+    TFEL_TESTS_ASSERT(
+        std::abs(vjp<1>(function<f2>, std::make_tuple(2., 1.), 3.) - 6) < eps);
+    const auto [dx, dy] = vjp(function<f2>, std::make_tuple(2., 1.), 3.);
+    TFEL_TESTS_ASSERT(std::abs(dx - 3) < eps);
+    TFEL_TESTS_ASSERT(std::abs(dy - 6) < eps);
+  }
+  void test2() {
+    using namespace tfel::math;
+    using namespace tfel::math::enzyme;
+    using namespace tfel::material;
+    constexpr auto E = double{70e9};
+    constexpr auto nu = double{0.3};
+    constexpr auto lambda = computeLambda(E, nu);
+    constexpr auto mu = computeMu(E, nu);
+    constexpr auto eps = double{1e-14};
+    using Stensor = stensor<3u, double>;
+    using Stensor4 = st2tost2<3u, double>;
+    // a non symmetric derivative, to check that the transpose of the
+    // jacobian is applied
+    const auto c = [](const Stensor& v) -> Stensor { return v(0) * v; };
+    const auto stress = [](const Stensor& e, const double T) -> Stensor {
+      return 2 * mu * e + lambda * trace(e) * Stensor::Id() -
+             E * 1e-5 * (T - 293.15) * Stensor::Id();
+    };
+    const auto s = Stensor{1, 2, 3, 4, 5, 6};
+    const auto w = Stensor{1, 0, 2, 0, 0, 3};
+    auto wK_ref = Stensor(0);
+    for (unsigned short i = 0; i != 6; ++i) {
+      for (unsigned short j = 0; j != 6; ++j) {
+        wK_ref(j) += w(i) * ((i == j ? s(0) : 0) + (j == 0 ? s(i) : 0));
+      }
+    }
+    TFEL_TESTS_ASSERT(abs(vjp(c, s, w) - wK_ref) < eps);
+    const Stensor4 K = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+    const auto e = Stensor{0.01, 0.02, 0, 0.03, 0, 0};
+    const auto T = double{400};
+    const Stensor wK = K * w;  // K is symmetric
+    const auto [wdsig_de, wdsig_dT] = vjp<0, 1>(stress, std::tie(e, T), w);
+    TFEL_TESTS_ASSERT(abs(wdsig_de - wK) < E * eps);
+    TFEL_TESTS_ASSERT(std::abs(wdsig_dT + E * 1e-5 * trace(w)) < E * eps);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(TFELMathEnzymeVJP, "TFELMathEnzymeVJP");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("tfel-math-enzyme-vjp.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}